@@ -37,6 +37,10 @@ namespace std {
 
 #include "ArxContainer/replace_minmax_macros.h"
 #include "ArxContainer/initializer_list.h"
+#include "ArxContainer/functional.h"
+
+#include <stdint.h>
+#include <string.h>
 
 #if ARX_HAVE_LIBSTDCPLUSPLUS >= 201103L  // Have libstdc++11
 
@@ -44,11 +48,15 @@ namespace std {
 #include <array>
 #include <deque>
 #include <map>
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
+#include <queue>
+#include <list>
+#include <bitset>
 
 #endif
 
-#include <limits.h>
-
 #ifndef ARX_VECTOR_DEFAULT_SIZE
 #define ARX_VECTOR_DEFAULT_SIZE 16
 #endif  // ARX_VECTOR_DEFAULT_SIZE
@@ -61,26 +69,373 @@ namespace std {
 #define ARX_MAP_DEFAULT_SIZE 16
 #endif  // ARX_MAP_DEFAULT_SIZE
 
+#ifndef ARX_SET_DEFAULT_SIZE
+#define ARX_SET_DEFAULT_SIZE 16
+#endif  // ARX_SET_DEFAULT_SIZE
+
+#ifndef ARX_UNORDERED_MAP_DEFAULT_SIZE
+#define ARX_UNORDERED_MAP_DEFAULT_SIZE 16
+#endif  // ARX_UNORDERED_MAP_DEFAULT_SIZE
+
+#ifndef ARX_UNORDERED_SET_DEFAULT_SIZE
+#define ARX_UNORDERED_SET_DEFAULT_SIZE 16
+#endif  // ARX_UNORDERED_SET_DEFAULT_SIZE
+
+#ifndef ARX_PRIORITY_QUEUE_DEFAULT_SIZE
+#define ARX_PRIORITY_QUEUE_DEFAULT_SIZE 16
+#endif  // ARX_PRIORITY_QUEUE_DEFAULT_SIZE
+
+#ifndef ARX_LIST_DEFAULT_SIZE
+#define ARX_LIST_DEFAULT_SIZE 16
+#endif  // ARX_LIST_DEFAULT_SIZE
+
+namespace arx {
+namespace container {
+    namespace detail {
+        // tag for our own placement new (<new> is not available everywhere)
+        struct placement_new_t {};
+    }  // namespace detail
+}  // namespace container
+}  // namespace arx
+
+inline void* operator new(size_t, arx::container::detail::placement_new_t, void* ptr) noexcept {
+    return ptr;
+}
+inline void operator delete(void*, arx::container::detail::placement_new_t, void*) noexcept {
+}
+
 namespace arx {
 
 namespace container {
     namespace detail {
         template <class T>
-        inline T&& move(T& t) { return static_cast<T&&>(t); }
+        constexpr T&& move(T& t) { return static_cast<T&&>(t); }
+
+        template <class T> struct remove_reference { using type = T; };
+        template <class T> struct remove_reference<T&> { using type = T; };
+        template <class T> struct remove_reference<T&&> { using type = T; };
+
+        template <class T> struct remove_const { using type = T; };
+        template <class T> struct remove_const<const T> { using type = T; };
+
+        // only for decltype
+        template <class T>
+        T&& declval();
+
+        template <class T>
+        constexpr T&& forward(typename remove_reference<T>::type& t) { return static_cast<T&&>(t); }
+        template <class T>
+        constexpr T&& forward(typename remove_reference<T>::type&& t) { return static_cast<T&&>(t); }
+
+        template <bool B, class T, class F>
+        struct conditional { using type = T; };
+        template <class T, class F>
+        struct conditional<false, T, F> { using type = F; };
+
+        // smallest unsigned integer type which can hold Max
+        template <size_t Max>
+        struct least_uint {
+            using type = typename conditional<(Max <= 0xFF), uint8_t,
+                typename conditional<(Max <= 0xFFFF), uint16_t, uint32_t>::type>::type;
+        };
+
+        // smallest signed integer type which can hold [-Max, Max]
+        template <size_t Max>
+        struct least_int {
+            using type = typename conditional<(Max <= 0x7F), int8_t,
+                typename conditional<(Max <= 0x7FFF), int16_t, int32_t>::type>::type;
+        };
+
+        // elements which can be moved around with memcpy/memmove
+        template <class T>
+        struct is_trivially_copyable {
+#if defined(__GNUC__) && __GNUC__ < 5 && !defined(__clang__)
+            static constexpr bool value = __has_trivial_copy(T) && __has_trivial_assign(T) && __has_trivial_destructor(T);
+#else
+            static constexpr bool value = __is_trivially_copyable(T);
+#endif
+        };
+
+        // exchange n bytes through a small chunk on the stack (instead of a temporary of n bytes)
+        inline void swap_bytes(void* x, void* y, size_t n) {
+            unsigned char* a = static_cast<unsigned char*>(x);
+            unsigned char* b = static_cast<unsigned char*>(y);
+            unsigned char t[16];
+            for (; n >= sizeof(t); n -= sizeof(t), a += sizeof(t), b += sizeof(t)) {
+                memcpy(t, a, sizeof(t));
+                memcpy(a, b, sizeof(t));
+                memcpy(b, t, sizeof(t));
+            }
+            for (; n > 0; --n, ++a, ++b) {
+                t[0] = *a;
+                *a = *b;
+                *b = t[0];
+            }
+        }
+
+        // tag to construct pair::second in place from the rest of the arguments
+        struct in_place_key_t {};
+
+        template <size_t N>
+        struct is_power_of_two {
+            static constexpr bool value = (N != 0) && ((N & (N - 1)) == 0);
+        };
+
+        // wrap a ring position into [0, N)
+        // RingBuffer keeps its head in [0, N) and positions in [0, 2N), so one add/sub is enough
+        // and no division is needed except for far out-of-range positions
+        template <size_t N, bool = is_power_of_two<N>::value>
+        struct index_wrap {
+            template <typename Index>
+            static Index next(const Index i) {
+                return (i == static_cast<Index>(N - 1)) ? 0 : static_cast<Index>(i + 1);
+            }
+            template <typename Index>
+            static Index prev(const Index i) {
+                return (i == 0) ? static_cast<Index>(N - 1) : static_cast<Index>(i - 1);
+            }
+            static int wrap(int pos) {
+                const int n = static_cast<int>(N);
+                if (pos >= n) {
+                    pos -= n;
+                    if (pos >= n) pos %= n;
+                } else if (pos < 0) {
+                    pos += n;
+                    if (pos < 0) pos = (n - 1) - ((-(pos + 1)) % n);
+                }
+                return pos;
+            }
+        };
+
+        // N is a power of two: masking wraps any position (two's complement)
+        template <size_t N>
+        struct index_wrap<N, true> {
+            template <typename Index>
+            static Index next(const Index i) {
+                return static_cast<Index>((i + 1) & (N - 1));
+            }
+            template <typename Index>
+            static Index prev(const Index i) {
+                return static_cast<Index>((i - 1) & (N - 1));
+            }
+            static int wrap(const int pos) {
+                return pos & (static_cast<int>(N) - 1);
+            }
+        };
+    }  // namespace detail
+
+    // contiguous part of the elements stored in a RingBuffer
+    template <typename T>
+    struct segment {
+        T* data;
+        size_t size;
+    };
+
+    // elements of a RingBuffer in order: first, then second (second.size is 0 if not wrapped)
+    template <typename T>
+    struct segments {
+        segment<T> first;
+        segment<T> second;
+    };
+
+    // result of pushing an element
+    enum class push_result : uint8_t {
+        ok,          // stored
+        overwritten, // stored, but an element was dropped to make room
+        rejected,    // not stored because the container is full
+    };
+
+    // overflow policies: what to do when pushing to a full container
+    // a custom policy only has to define these two constants
+    namespace overflow {
+        // drop the oldest element (the opposite end of the push)
+        struct overwrite {
+            static constexpr bool rejects_new = false;
+            static constexpr bool counts_drops = false;
+        };
+        // keep the stored elements and refuse the new one
+        struct reject {
+            static constexpr bool rejects_new = true;
+            static constexpr bool counts_drops = false;
+        };
+        // refuse the new one and count it in dropped()
+        struct saturate {
+            static constexpr bool rejects_new = true;
+            static constexpr bool counts_drops = true;
+        };
+    }  // namespace overflow
+
+    namespace detail {
+        // number of elements lost by overflow (saturates instead of wrapping around)
+        template <bool Count>
+        struct drop_counter {
+            uint32_t dropped_ {0};
+
+            void count_drop(const size_t n = 1) {
+                const uint32_t room = UINT32_MAX - dropped_;
+                dropped_ += (n < room) ? static_cast<uint32_t>(n) : room;
+            }
+            uint32_t dropped() const { return dropped_; }
+            void reset_dropped() { dropped_ = 0; }
+            void swap_dropped(drop_counter& r) {
+                const uint32_t t = dropped_;
+                dropped_ = r.dropped_;
+                r.dropped_ = t;
+            }
+        };
+
+        template <>
+        struct drop_counter<false> {
+            void count_drop(const size_t = 1) {}
+            uint32_t dropped() const { return 0; }
+            void reset_dropped() {}
+            void swap_dropped(drop_counter&) {}
+        };
+    }  // namespace detail
+
+    // storage modes of RingBuffer
+    // initialized_storage   : T[N], all slots are default-constructed when the buffer is created
+    // uninitialized_storage : raw memory, elements are constructed on push and destroyed on pop/erase/clear
+    struct initialized_storage {};
+    struct uninitialized_storage {};
+
+    namespace detail {
+        // how to store into / remove from a slot which holds no element
+        template <typename T, typename Storage>
+        struct slot_ops;
+
+        // every slot always holds an object: storing is an assignment
+        template <typename T>
+        struct slot_ops<T, initialized_storage> {
+            template <class U>
+            static void put(T* p, U&& v) {
+                *p = detail::forward<U>(v);
+            }
+            template <class... Args>
+            static void emplace(T* p, Args&&... args) {
+                p->~T();
+                new (placement_new_t(), p) T(detail::forward<Args>(args)...);
+            }
+            static void destroy(T*) {}
+        };
+
+        // free slots are raw memory: storing constructs a new object
+        template <typename T>
+        struct slot_ops<T, uninitialized_storage> {
+            template <class U>
+            static void put(T* p, U&& v) {
+                new (placement_new_t(), p) T(detail::forward<U>(v));
+            }
+            template <class... Args>
+            static void emplace(T* p, Args&&... args) {
+                new (placement_new_t(), p) T(detail::forward<Args>(args)...);
+            }
+            static void destroy(T* p) { p->~T(); }
+        };
+
+        // head_ is always in [0, N) and size_ in [0, N],
+        // so both fit in the smallest unsigned type which can hold N
+        template <typename T, size_t N, typename Storage>
+        struct ring_storage;
+
+        template <typename T, size_t N>
+        struct ring_storage<T, N, initialized_storage> : slot_ops<T, initialized_storage> {
+            using index_type = typename least_uint<N>::type;
+
+            T queue_[N];
+            index_type head_;
+            index_type size_;
+
+            ring_storage()
+            : queue_()
+            , head_(0)
+            , size_(0) {}
+
+            T* buffer() { return queue_; }
+            const T* buffer() const { return queue_; }
+        };
+
+        template <typename T, size_t N>
+        struct ring_storage<T, N, uninitialized_storage> : slot_ops<T, uninitialized_storage> {
+            using index_type = typename least_uint<N>::type;
+
+            alignas(T) unsigned char queue_[sizeof(T) * N];
+            index_type head_;
+            index_type size_;
+
+            ring_storage()
+            : head_(0)
+            , size_(0) {}
+            ring_storage(const ring_storage&) = delete;
+            ring_storage& operator=(const ring_storage&) = delete;
+            ~ring_storage() {
+                for (size_t i = 0; i < size_; ++i)
+                    this->destroy(buffer() + index_wrap<N>::wrap(head_ + static_cast<int>(i)));
+            }
+
+            T* buffer() { return reinterpret_cast<T*>(queue_); }
+            const T* buffer() const { return reinterpret_cast<const T*>(queue_); }
+        };
+
+        // storage of contiguous containers: elements are always in [0, size_)
+        template <typename T, size_t N, typename Storage>
+        struct linear_storage;
+
+        template <typename T, size_t N>
+        struct linear_storage<T, N, initialized_storage> : slot_ops<T, initialized_storage> {
+            T queue_[N];
+            size_t size_;
+
+            linear_storage()
+            : queue_()
+            , size_(0) {}
+
+            T* buffer() { return queue_; }
+            const T* buffer() const { return queue_; }
+        };
+
+        template <typename T, size_t N>
+        struct linear_storage<T, N, uninitialized_storage> : slot_ops<T, uninitialized_storage> {
+            alignas(T) unsigned char queue_[sizeof(T) * N];
+            size_t size_;
+
+            linear_storage()
+            : size_(0) {}
+            linear_storage(const linear_storage&) = delete;
+            linear_storage& operator=(const linear_storage&) = delete;
+            ~linear_storage() {
+                for (size_t i = 0; i < size_; ++i)
+                    this->destroy(buffer() + i);
+            }
+
+            T* buffer() { return reinterpret_cast<T*>(queue_); }
+            const T* buffer() const { return reinterpret_cast<const T*>(queue_); }
+        };
     }  // namespace detail
 }  // namespace container
+}  // namespace arx
 
-template <typename T, size_t N>
-class RingBuffer {
+#include "ArxContainer/container_ref.h"
+
+namespace arx {
+
+template <typename T, size_t N,
+          typename Storage = container::initialized_storage,
+          typename Overflow = container::overflow::overwrite>
+class RingBuffer : protected container::detail::ring_storage<T, N, Storage>,
+                   protected container::detail::drop_counter<Overflow::counts_drops> {
     class Iterator;
     class ConstIterator {
-        friend RingBuffer<T, N>;
+        friend RingBuffer;
+
+        // positions of the elements are in [0, 2N)
+        using pos_type = typename container::detail::least_int<2 * N>::type;
 
         const T* ptr {nullptr};  // pointer to the first element
-        int pos {0};
+        pos_type pos {0};
 
-        ConstIterator(const T* ptr, int pos)
-        : ptr(ptr), pos(pos) {}
+        ConstIterator(const T* ptr, const int pos)
+        : ptr(ptr), pos(static_cast<pos_type>(pos)) {}
 
     public:
         ConstIterator() {}
@@ -112,10 +467,7 @@ class RingBuffer {
 
     private:
         static int pos_wrap_around(const int pos) {
-            if (pos >= 0)
-                return pos % N;
-            else
-                return (N - 1) - (abs(pos + 1) % N);
+            return container::detail::index_wrap<N>::wrap(pos);
         }
 
     public:
@@ -143,11 +495,11 @@ class RingBuffer {
             return ConstIterator(this->ptr, this->pos - n);
         }
         ConstIterator& operator+=(const int n) {
-            this->pos += n;
+            this->pos = static_cast<pos_type>(this->pos + n);
             return *this;
         }
         ConstIterator& operator-=(const int n) {
-            this->pos -= n;
+            this->pos = static_cast<pos_type>(this->pos - n);
             return *this;
         }
 
@@ -197,7 +549,7 @@ class RingBuffer {
         }
 
         void set(const int i) {
-            pos = i;
+            pos = static_cast<pos_type>(i);
         }
 
         void reset() {
@@ -206,11 +558,11 @@ class RingBuffer {
     };
 
     class Iterator : public ConstIterator {
-        friend RingBuffer<T, N>;
+        friend RingBuffer;
 
-        Iterator(const T* ptr, int pos) {
+        Iterator(const T* ptr, const int pos) {
             this->ptr = ptr;
-            this->pos = pos;
+            this->pos = static_cast<typename ConstIterator::pos_type>(pos);
         }
 
     public:
@@ -234,12 +586,14 @@ class RingBuffer {
         Iterator operator-(const int n) const {
             return Iterator(this->ptr, this->pos - n);
         }
+        // distance between iterators (hidden by operator-(int) above)
+        using ConstIterator::operator-;
         Iterator& operator+=(const int n) {
-            this->pos += n;
+            ConstIterator::operator+=(n);
             return *this;
         }
         Iterator& operator-=(const int n) {
-            this->pos -= n;
+            ConstIterator::operator-=(n);
             return *this;
         }
 
@@ -269,24 +623,24 @@ protected:
     friend class Iterator;
     friend class ConstIterator;
 
-    T queue_[N];
-    int head_;
-    int tail_;
+    using storage = container::detail::ring_storage<T, N, Storage>;
+    using index_type = typename storage::index_type;
+    using wrap = container::detail::index_wrap<N>;
+    using storage::head_;
+    using storage::size_;
+    using counter = container::detail::drop_counter<Overflow::counts_drops>;
 
 public:
+    using value_type = T;
     using iterator = Iterator;
     using const_iterator = ConstIterator;
 
     RingBuffer()
-    : queue_()
-    , head_(0)
-    , tail_(0) {
+    : storage() {
     }
 
     RingBuffer(std::initializer_list<T> lst)
-    : queue_()
-    , head_(0)
-    , tail_(0) {
+    : storage() {
         for (auto it = lst.begin(); it != lst.end(); ++it) {
             push_back(*it);
         }
@@ -294,103 +648,127 @@ public:
 
     // copy
     explicit RingBuffer(const RingBuffer& r)
-    : queue_()
-    , head_(r.head_)
-    , tail_(r.tail_) {
-        const_iterator it = r.begin();
-        for (size_t i = 0; i < r.size(); ++i) {
-            int pos = it.index_with_offset(i);
-            queue_[pos] = r.queue_[pos];
-        }
+    : storage() {
+        copy_from(r);
     }
     RingBuffer& operator=(const RingBuffer& r) {
-        head_ = r.head_;
-        tail_ = r.tail_;
-        const_iterator it = r.begin();
-        for (size_t i = 0; i < r.size(); ++i) {
-            int pos = it.index_with_offset(i);
-            queue_[pos] = r.queue_[pos];
+        if (this != &r) {
+            clear();
+            copy_from(r);
         }
         return *this;
     }
 
     // move
-    RingBuffer(RingBuffer&& r) {
-        head_ = container::detail::move(r.head_);
-        tail_ = container::detail::move(r.tail_);
-        const_iterator it = r.begin();
-        for (size_t i = 0; i < r.size(); ++i) {
-            int pos = it.index_with_offset(i);
-            queue_[pos] = container::detail::move(r.queue_[pos]);
-        }
+    RingBuffer(RingBuffer&& r)
+    : storage() {
+        move_from(r);
     }
 
     RingBuffer& operator=(RingBuffer&& r) {
-        head_ = container::detail::move(r.head_);
-        tail_ = container::detail::move(r.tail_);
-        const_iterator it = r.begin();
-        for (size_t i = 0; i < r.size(); ++i) {
-            int pos = it.index_with_offset(i);
-            queue_[pos] = container::detail::move(r.queue_[pos]);
+        if (this != &r) {
+            clear();
+            move_from(r);
         }
         return *this;
     }
 
+    // exchange the elements (and dropped()) with r without a temporary buffer.
+    // trivially copyable elements are exchanged as the raw bytes of the whole storage,
+    // others slot by slot (an element is moved if only one side holds one in that slot).
+    // double buffering: fill one buffer while the other one, swapped out, is processed
+    void swap(RingBuffer& r) {
+        if (this == &r) return;
+        if (container::detail::is_trivially_copyable<T>::value) {
+            container::detail::swap_bytes(this->queue_, r.queue_, sizeof(this->queue_));
+        } else {
+            for (size_t i = 0; i < N; ++i) swap_slot(r, i);
+        }
+        const index_type h = head_, s = size_;
+        head_ = r.head_;
+        size_ = r.size_;
+        r.head_ = h;
+        r.size_ = s;
+        counter::swap_dropped(r);
+    }
+
     size_t capacity() const { return N; };
-    size_t size() const { return tail_ - head_; }
+    size_t size() const { return size_; }
     // data() method better not to use :-(
     // it should point to the 1st item and have enough space for size() readings of items
     // impossible with ringbuffer - either points to the 1st item or has enough space
     // only exception when it works is when head_ pos == 0
-    const T* data() const { return reinterpret_cast<const T*>(&(queue_)); }
-    T* data() { return reinterpret_cast<T*>(&(queue_)); }
-    bool empty() const { return tail_ == head_; }
-    void clear() { head_ = tail_ = 0; }
+    const T* data() const { return this->buffer(); }
+    T* data() { return this->buffer(); }
+    bool empty() const { return size_ == 0; }
+    void clear() {
+        for (size_t i = 0; i < size(); ++i)
+            storage::destroy(ptr(static_cast<int>(i)));
+        head_ = size_ = 0;
+    }
 
     void pop() {
         pop_front();
     }
     void pop_front() {
         if (size() == 0) return;
-        if (size() == 1)
-            clear();
-        else
-            increment_head();
+        storage::destroy(ptr(0));
+        increment_head();
     }
     void pop_back() {
         if (size() == 0) return;
-        if (size() == 1)
-            clear();
-        else
-            decrement_tail();
+        storage::destroy(ptr(static_cast<int>(size()) - 1));
+        decrement_tail();
     }
 
-    void push(const T& data) {
-        push_back(data);
+    // number of elements lost by overflow (always 0 if the policy doesn't count)
+    using counter::dropped;
+    using counter::reset_dropped;
+
+    container::push_result push(const T& data) {
+        return push_back(data);
     }
-    void push(T&& data) {
-        push_back(data);
+    container::push_result push(T&& data) {
+        return push_back(container::detail::move(data));
     }
-    void push_back(const T& data) {
-        get(size()) = data;
-        increment_tail();
+    container::push_result push_back(const T& data) {
+        return store_back(data);
     }
-    void push_back(T&& data) {
-        get(size()) = data;
-        increment_tail();
+    container::push_result push_back(T&& data) {
+        return store_back(container::detail::move(data));
     }
-    void push_front(const T& data) {
-        decrement_head();
-        get(0) = data;
+    container::push_result push_front(const T& data) {
+        return store_front(data);
+    }
+    container::push_result push_front(T&& data) {
+        return store_front(container::detail::move(data));
+    }
+    template <class... Args>
+    container::push_result emplace(Args&&... args) {
+        return emplace_back(container::detail::forward<Args>(args)...);
+    }
+    template <class... Args>
+    container::push_result emplace_back(Args&&... args) {
+        if (size() == capacity()) {
+            if (Overflow::rejects_new) return reject();
+            // the slot to be reused is the oldest element, which args may refer to
+            return push_back(T(container::detail::forward<Args>(args)...));
+        }
+        storage::emplace(ptr(static_cast<int>(size())), container::detail::forward<Args>(args)...);
+        increment_tail();
+        return container::push_result::ok;
     }
-    void push_front(T&& data) {
+    template <class... Args>
+    container::push_result emplace_front(Args&&... args) {
+        if (size() == capacity()) {
+            if (Overflow::rejects_new) return reject();
+            // the slot to be reused is the newest element, which args may refer to
+            return push_front(T(container::detail::forward<Args>(args)...));
+        }
         decrement_head();
-        get(0) = data;
+        storage::emplace(ptr(0), container::detail::forward<Args>(args)...);
+        return container::push_result::ok;
     }
-    void emplace(const T& data) { push(data); }
-    void emplace(T&& data) { push(data); }
-    void emplace_back(const T& data) { push_back(data); }
-    void emplace_back(T&& data) { push_back(data); }
 
     const T& front() const { return get(0); }
     T& front() { return get(0); }
@@ -401,30 +779,35 @@ public:
     const T& operator[](size_t index) const { return get(static_cast<int>(index)); }
     T& operator[](size_t index) { return get(static_cast<int>(index)); }
 
-    iterator begin() { return empty() ? Iterator() : Iterator(queue_, head_); }
-    iterator end() { return empty() ? Iterator() : Iterator(queue_, tail_); }
-    const_iterator begin() const { return empty() ? ConstIterator() : ConstIterator(queue_, head_); }
-    const_iterator end() const { return empty() ? ConstIterator() : ConstIterator(queue_, tail_); }
+    iterator begin() { return empty() ? Iterator() : Iterator(this->buffer(), head_); }
+    iterator end() { return empty() ? Iterator() : Iterator(this->buffer(), tail()); }
+    const_iterator begin() const { return empty() ? ConstIterator() : ConstIterator(this->buffer(), head_); }
+    const_iterator end() const { return empty() ? ConstIterator() : ConstIterator(this->buffer(), tail()); }
 
-    // https://en.cppreference.com/w/cpp/container/vector/erase
+    // https://en.cppreference.com/w/cpp/container/deque/erase
+    // the elements before or after the erased range are shifted, whichever are fewer
     iterator erase(const const_iterator& p) {
         if (!is_valid(p)) return end();
+        return erase(p, p + 1);
+    }
 
-        iterator it_last = end() - 1;
-        for (iterator it = p.to_iterator(); it != it_last; ++it)
-            *it = *(it + 1);
-        *it_last = T();
-        decrement_tail();
-        return empty() ? end() : p.to_iterator();
+    iterator erase(const const_iterator& first, const const_iterator& last) {
+        if (!is_valid(first) || last < first || (last != end() && !is_valid(last))) return end();
+
+        const int index = first - begin();
+        ref().erase_n(static_cast<size_t>(index), static_cast<size_t>(last - first));
+        return empty() ? end() : Iterator(this->buffer(), head_ + index);
+    }
+
+    // erase all the elements which satisfy pred, and return the number of erased elements
+    // the remaining elements are compacted in one pass (runs of them are moved at once)
+    template <class Pred>
+    size_t erase_if(Pred pred) {
+        return ref().erase_if(pred);
     }
 
     void resize(size_t sz) {
-        size_t s = size();
-        if (sz > s) {
-            for (size_t i = 0; i < sz - s; ++i) push(T());
-        } else if (sz < s) {
-            for (size_t i = 0; i < s - sz; ++i) pop();
-        }
+        ref().resize(sz);
     }
 
     void assign(const_iterator first, const_iterator end) {
@@ -452,261 +835,624 @@ public:
     }
 
     // https://en.cppreference.com/w/cpp/container/vector/insert
+    // if the result exceeds the capacity, elements after the inserted range are dropped,
+    // or, if the inserted range itself does not fit, the front elements are overwritten.
+    // if the policy rejects new elements, nothing is inserted unless all of them fit.
     void insert(const const_iterator& pos, const const_iterator& first, const const_iterator& last) {
         if (!is_valid(pos) && pos != end())
             return;
 
-        size_t sz = last - first;
-
-        size_t new_sz = size() + sz;
-        if (new_sz > capacity())
-            new_sz = capacity();
-
-        iterator it = begin() + new_sz - 1;
-        while (it != pos) {
-            *it = *(it - sz);
-            --it;
-        }
-        for (size_t i = 0; i < sz; ++i) {
-            *(it + i) = *(first + i);
-            if (size() < capacity() || (it + i) == end())
-                increment_tail();
-        }
+        ref().insert_n(static_cast<size_t>(pos - begin()), first, static_cast<size_t>(last - first));
     }
 
     void insert(const const_iterator& pos, const T* first, const T* last) {
         if (!is_valid(pos) && pos != end())
             return;
 
-        size_t sz = last - first;
+        ref().insert_n(static_cast<size_t>(pos - begin()), first, static_cast<size_t>(last - first));
+    }
 
-        size_t new_sz = size() + sz;
-        if (new_sz > capacity())
-            new_sz = capacity();
+    // val may refer to an element to be shifted, so it is copied first
+    void insert(const const_iterator& pos, const T& val) {
+        insert(pos, T(val));
+    }
 
-        iterator it = begin() + new_sz - 1;
-        while (it != pos) {
-            *it = *(it - sz);
-            --it;
+    void insert(const const_iterator& pos, T&& val) {
+        if (!is_valid(pos) && pos != end())
+            return;
+
+        ref().insert_one(static_cast<size_t>(pos - begin()), container::detail::move(val));
+    }
+
+    // push n elements to the back, and return the number of elements stored.
+    // if there is no space, the oldest ones are overwritten, or the rest of src is rejected
+    // trivially copyable elements are copied by at most two memcpy
+    // (implemented here rather than in deque_ref, so that the positions are wrapped with N known at compile time)
+    size_t push_back(const T* src, size_t n) {
+        if (Overflow::rejects_new && size() + n > N) {
+            reject(size() + n - N);
+            n = N - size();
+        }
+        if (!container::detail::is_trivially_copyable<T>::value) {
+            for (size_t i = 0; i < n; ++i) push_back(src[i]);
+            return n;
         }
-        for (size_t i = 0; i < sz; ++i) {
-            *(it + i) = *(first + i);
-            if (size() < capacity() || (it + i) == end())
-                increment_tail();
+        const size_t pushed = n;
+        if (size() + n > N)
+            counter::count_drop(size() + n - N);
+        if (n >= N) {
+            // only the last N elements survive
+            src += n - N;
+            n = N;
+            head_ = size_ = 0;
+        } else if (size() + n > N) {
+            const size_t drop = size() + n - N;
+            head_ = static_cast<index_type>(wrap::wrap(head_ + static_cast<int>(drop)));
+            size_ = static_cast<index_type>(size_ - drop);
         }
+        copy_in(size(), src, n);
+        size_ = static_cast<index_type>(size_ + n);
+        return pushed;
     }
 
-    void insert(const const_iterator& pos, const T& val) {
-        const T* ptr = &val;
-        insert(pos, ptr, ptr + 1);
+    // move up to n elements from the front to dst, and return the number of elements popped
+    size_t pop_front(T* dst, size_t n) {
+        if (n > size()) n = size();
+        if (!container::detail::is_trivially_copyable<T>::value) {
+            for (size_t i = 0; i < n; ++i) {
+                dst[i] = container::detail::move(front());
+                pop_front();
+            }
+            return n;
+        }
+        copy_out(dst, 0, n);
+        head_ = static_cast<index_type>(wrap::wrap(head_ + static_cast<int>(n)));
+        size_ = static_cast<index_type>(size_ - n);
+        return n;
+    }
+
+    // copy up to n elements from offset to dst without removing them,
+    // and return the number of elements copied
+    size_t peek(T* dst, size_t n, size_t offset = 0) const {
+        if (offset >= size()) return 0;
+        if (n > size() - offset) n = size() - offset;
+        copy_out(dst, offset, n);
+        return n;
+    }
+
+    // the stored elements as (at most) two contiguous blocks, e.g. to pass to DMA or write()
+    container::segments<T> linear_segments() {
+        const size_t first = contiguous_size();
+        return {{this->buffer() + head_, first}, {this->buffer(), size() - first}};
+    }
+    container::segments<const T> linear_segments() const {
+        const size_t first = contiguous_size();
+        return {{this->buffer() + head_, first}, {this->buffer(), size() - first}};
+    }
+
+    // reference which doesn't depend on N (see deque_ref)
+    operator stdx::deque_ref<T, Storage, Overflow>() {
+        return ref();
     }
 
 private:
+    // insert/erase are implemented once for all N in deque_ref
+    stdx::deque_ref<T, Storage, Overflow> ref() {
+        return stdx::deque_ref<T, Storage, Overflow>(this->buffer(), head_, size_, N, static_cast<counter&>(*this));
+    }
+
     T& get(const iterator& it) {
-        return queue_[it.index()];
+        return this->buffer()[it.index()];
     }
     const T& get(const const_iterator& it) const {
-        return queue_[it.index()];
+        return this->buffer()[it.index()];
     }
     T& get(const int index) {
-        return queue_[begin().index_with_offset(index)];
+        return this->buffer()[wrap::wrap(head_ + index)];
     }
     const T& get(const int index) const {
-        return queue_[begin().index_with_offset(index)];
+        return this->buffer()[wrap::wrap(head_ + index)];
     }
 
     T* ptr(const iterator& it) {
-        return queue_ + it.index();
+        return this->buffer() + it.index();
     }
     const T* ptr(const const_iterator& it) const {
-        return queue_ + it.index();
+        return this->buffer() + it.index();
     }
     T* ptr(const int index) {
-        return queue_ + begin().index_with_offset(index);
+        return this->buffer() + wrap::wrap(head_ + index);
     }
     const T* ptr(const int index) const {
-        return queue_ + begin().index_with_offset(index);
+        return this->buffer() + wrap::wrap(head_ + index);
+    }
+
+    // raw position next to the last element, in [0, 2N)
+    int tail() const {
+        return head_ + size_;
+    }
+
+    // number of elements from head_ before the storage wraps around
+    size_t contiguous_size() const {
+        const size_t to_end = N - static_cast<size_t>(head_);
+        return size() < to_end ? size() : to_end;
+    }
+
+    // copy n elements from the logical index, in at most two blocks
+    void copy_out(T* dst, const size_t index, const size_t n) const {
+        if (!container::detail::is_trivially_copyable<T>::value) {
+            for (size_t i = 0; i < n; ++i) dst[i] = get(static_cast<int>(index + i));
+            return;
+        }
+        if (n == 0) return;
+        const size_t pos = static_cast<size_t>(wrap::wrap(head_ + static_cast<int>(index)));
+        const size_t first = n < N - pos ? n : N - pos;
+        memcpy(static_cast<void*>(dst), static_cast<const void*>(this->buffer() + pos), first * sizeof(T));
+        memcpy(static_cast<void*>(dst + first), static_cast<const void*>(this->buffer()), (n - first) * sizeof(T));
+    }
+
+    // copy n trivially copyable elements to the free slots from the logical index
+    void copy_in(const size_t index, const T* src, const size_t n) {
+        if (n == 0) return;
+        const size_t pos = static_cast<size_t>(wrap::wrap(head_ + static_cast<int>(index)));
+        const size_t first = n < N - pos ? n : N - pos;
+        memcpy(static_cast<void*>(this->buffer() + pos), static_cast<const void*>(src), first * sizeof(T));
+        memcpy(static_cast<void*>(this->buffer()), static_cast<const void*>(src + first), (n - first) * sizeof(T));
+    }
+
+    container::push_result reject(const size_t n = 1) {
+        counter::count_drop(n);
+        return container::push_result::rejected;
+    }
+
+    // if full, the oldest element's slot is reused (it is still constructed)
+    template <class U>
+    container::push_result store_back(U&& data) {
+        if (size() == capacity()) {
+            if (Overflow::rejects_new) return reject();
+            counter::count_drop();
+            get(0) = container::detail::forward<U>(data);
+            head_ = wrap::next(head_);
+            return container::push_result::overwritten;
+        }
+        storage::put(ptr(static_cast<int>(size())), container::detail::forward<U>(data));
+        increment_tail();
+        return container::push_result::ok;
+    }
+    // if full, the newest element's slot is reused (it is still constructed)
+    template <class U>
+    container::push_result store_front(U&& data) {
+        if (size() == capacity()) {
+            if (Overflow::rejects_new) return reject();
+            counter::count_drop();
+            head_ = wrap::prev(head_);
+            get(0) = container::detail::forward<U>(data);
+            return container::push_result::overwritten;
+        }
+        decrement_head();
+        storage::put(ptr(0), container::detail::forward<U>(data));
+        return container::push_result::ok;
+    }
+    // elements are stored at the same raw positions as in r (this must be empty),
+    // so both segments are contiguous on both sides and no index is wrapped per element.
+    // trivially copyable elements are copied by one memcpy per segment
+    void copy_from(const RingBuffer& r) {
+        head_ = r.head_;
+        size_ = r.size_;
+        const size_t first = contiguous_size();
+        copy_range(this->buffer() + head_, r.buffer() + head_, first);
+        copy_range(this->buffer(), r.buffer(), size() - first);
+    }
+
+    void move_from(RingBuffer& r) {
+        head_ = r.head_;
+        size_ = r.size_;
+        const size_t first = contiguous_size();
+        move_range(this->buffer() + head_, r.buffer() + head_, first);
+        move_range(this->buffer(), r.buffer(), size() - first);
+        r.clear();
+    }
+
+    static void copy_range(T* dst, const T* src, const size_t n) {
+        if (container::detail::is_trivially_copyable<T>::value) {
+            memcpy(static_cast<void*>(dst), static_cast<const void*>(src), n * sizeof(T));
+        } else {
+            for (size_t i = 0; i < n; ++i)
+                storage::put(dst + i, src[i]);
+        }
     }
 
+    static void move_range(T* dst, T* src, const size_t n) {
+        if (container::detail::is_trivially_copyable<T>::value) {
+            memcpy(static_cast<void*>(dst), static_cast<const void*>(src), n * sizeof(T));
+        } else {
+            for (size_t i = 0; i < n; ++i)
+                storage::put(dst + i, container::detail::move(src[i]));
+        }
+    }
+
+    // raw slot i holds an element
+    bool holds(const size_t i) const {
+        return static_cast<size_t>(wrap::wrap(static_cast<int>(i) - head_)) < size();
+    }
+
+    // exchange raw slot i with the same slot of r
+    void swap_slot(RingBuffer& r, const size_t i) {
+        T* a = this->buffer() + i;
+        T* b = r.buffer() + i;
+        if (holds(i) && r.holds(i)) {
+            T t(container::detail::move(*a));
+            *a = container::detail::move(*b);
+            *b = container::detail::move(t);
+        } else if (holds(i)) {
+            storage::put(b, container::detail::move(*a));
+            storage::destroy(a);
+        } else if (r.holds(i)) {
+            storage::put(a, container::detail::move(*b));
+            storage::destroy(b);
+        }
+    }
+
+    // head_ and size_ never leave [0, N), so no renormalization is needed
+    // these are only called when there is an element to remove / a free slot to use
     void increment_head() {
-        ++head_;
-        resolve_overflow();
+        head_ = wrap::next(head_);
+        --size_;
     }
     void increment_tail() {
-        ++tail_;
-        resolve_overflow();
-        if (size() > N)
-            increment_head();
+        ++size_;
     }
     void decrement_head() {
-        --head_;
-        resolve_overflow();
-        if (size() > N)
-            decrement_tail();
+        head_ = wrap::prev(head_);
+        ++size_;
     }
     void decrement_tail() {
-        --tail_;
-        resolve_overflow();
-    }
-
-    void resolve_overflow() {
-        if (empty())
-            clear();
-        else if (head_ <= (static_cast<int>(INT_MIN) + static_cast<int>(capacity())) \
-                || tail_ >= (static_cast<int>(INT_MAX) - static_cast<int>(capacity()))) {
-            // +/- capacity(): reserve some space for pointer/iterator arithmetics
-            // head_/tail_ pointers are re-set N+1 steps before the overflow occurs
-            int len = size();
-            head_ = begin().index();
-            tail_ = head_ + len;
-        }
+        --size_;
     }
 
     bool is_valid(const const_iterator& it) const {
-        if (it.ptr != queue_)
+        if (it.ptr != this->buffer())
             return false; // iterator to a different object
-        return (it.raw_pos() >= head_) && (it.raw_pos() < tail_);
+        return (it.raw_pos() >= head_) && (it.raw_pos() < tail());
     }
 };
 
 } // namespace arx
 
-template <typename T, size_t N>
-inline bool operator==(const arx::RingBuffer<T, N>& x, const arx::RingBuffer<T, N>& y) {
+template <typename T, size_t N, typename S, typename O>
+inline bool operator==(const arx::RingBuffer<T, N, S, O>& x, const arx::RingBuffer<T, N, S, O>& y) {
     if (x.size() != y.size()) return false;
     for (size_t i = 0; i < x.size(); ++i)
         if (x[i] != y[i]) return false;
     return true;
 }
 
-template <typename T, size_t N>
-inline bool operator!=(const arx::RingBuffer<T, N>& x, const arx::RingBuffer<T, N>& y) {
+template <typename T, size_t N, typename S, typename O>
+inline bool operator!=(const arx::RingBuffer<T, N, S, O>& x, const arx::RingBuffer<T, N, S, O>& y) {
     return !(x == y);
 }
 
+namespace arx {
+
+// found by argument dependent lookup (using std::swap; swap(x, y);)
+template <typename T, size_t N, typename S, typename O>
+inline void swap(RingBuffer<T, N, S, O>& x, RingBuffer<T, N, S, O>& y) {
+    x.swap(y);
+}
+
+} // namespace arx
+
 namespace arx {
 namespace stdx {
 
-template <typename T, size_t N = ARX_VECTOR_DEFAULT_SIZE>
-struct vector : public RingBuffer<T, N> {
-    using iterator = typename RingBuffer<T, N>::iterator;
-    using const_iterator = typename RingBuffer<T, N>::const_iterator;
+// vector keeps its elements contiguous in [data(), data() + size()),
+// so iterators are plain pointers and data() can be passed to anything taking a buffer.
+// if it's full, push_back() drops the front element as RingBuffer does (costs a shift of all elements),
+// unless the Overflow policy rejects new elements.
+template <typename T, size_t N = ARX_VECTOR_DEFAULT_SIZE,
+          typename Storage = container::initialized_storage,
+          typename Overflow = container::overflow::overwrite>
+struct vector : protected container::detail::linear_storage<T, N, Storage>,
+                protected container::detail::drop_counter<Overflow::counts_drops> {
+protected:
+    using storage = container::detail::linear_storage<T, N, Storage>;
+    using storage::size_;
+    using counter = container::detail::drop_counter<Overflow::counts_drops>;
+
+public:
+    using value_type = T;
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    // number of elements lost by overflow (always 0 if the policy doesn't count)
+    using counter::dropped;
+    using counter::reset_dropped;
 
     vector()
-    : RingBuffer<T, N>() {}
+    : storage() {}
     vector(std::initializer_list<T> lst)
-    : RingBuffer<T, N>(lst) {}
+    : storage() {
+        assign(lst.begin(), lst.end());
+    }
 
     // copy
     vector(const vector& r)
-    : RingBuffer<T, N>(r) {}
+    : storage() {
+        assign(r.begin(), r.end());
+    }
 
     vector& operator=(const vector& r) {
-        RingBuffer<T, N>::operator=(r);
+        if (this != &r) assign(r.begin(), r.end());
         return *this;
     }
 
     // move
     vector(vector&& r)
-    : RingBuffer<T, N>(r) {}
+    : storage() {
+        move_from(r);
+    }
 
     vector& operator=(vector&& r) {
-        RingBuffer<T, N>::operator=(r);
+        if (this != &r) {
+            clear();
+            move_from(r);
+        }
         return *this;
     }
 
+    size_t capacity() const { return N; }
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+    const T* data() const { return this->buffer(); }
+    T* data() { return this->buffer(); }
+
+    void clear() {
+        for (size_t i = 0; i < size_; ++i)
+            storage::destroy(data() + i);
+        size_ = 0;
+    }
+
+    void pop_back() {
+        if (size_ == 0) return;
+        storage::destroy(data() + size_ - 1);
+        --size_;
+    }
+
+    // if full, the element is dropped or the front one is (see vector_ref)
+    container::push_result push_back(const T& data) {
+        if (size_ == N) return ref().push_back(data);
+        storage::put(this->data() + size_++, data);
+        return container::push_result::ok;
+    }
+    container::push_result push_back(T&& data) {
+        if (size_ == N) return ref().push_back(container::detail::move(data));
+        storage::put(this->data() + size_++, container::detail::move(data));
+        return container::push_result::ok;
+    }
+    template <class... Args>
+    container::push_result emplace_back(Args&&... args) {
+        if (size_ == N) return ref().emplace_back(container::detail::forward<Args>(args)...);
+        storage::emplace(data() + size_, container::detail::forward<Args>(args)...);
+        ++size_;
+        return container::push_result::ok;
+    }
+
+    const T& front() const { return data()[0]; }
+    T& front() { return data()[0]; }
+
+    const T& back() const { return data()[size_ - 1]; }
+    T& back() { return data()[size_ - 1]; }
+
+    const T& operator[](size_t index) const { return data()[index]; }
+    T& operator[](size_t index) { return data()[index]; }
+
+    iterator begin() { return data(); }
+    iterator end() { return data() + size_; }
+    const_iterator begin() const { return data(); }
+    const_iterator end() const { return data() + size_; }
+
+    // https://en.cppreference.com/w/cpp/container/vector/erase
+    iterator erase(const_iterator pos) {
+        return ref().erase(pos);
+    }
+
+    iterator erase(const_iterator first, const_iterator last) {
+        return ref().erase(first, last);
+    }
+
+    void resize(size_t sz) {
+        ref().resize(sz);
+    }
+
+    // if the range is longer than the capacity, only the last N elements are kept,
+    // or the first N if the policy rejects new elements
+    void assign(const_iterator first, const_iterator last) {
+        ref().assign(first, last);
+    }
+
+    void shrink_to_fit() {
+        // dummy
+    }
+
+    void reserve(size_t n) {
+        (void)n;
+        // dummy
+    }
+
+    // https://en.cppreference.com/w/cpp/container/vector/insert
+    // if the result exceeds the capacity, elements after the inserted range are dropped,
+    // or, if the inserted range itself does not fit, the front elements are dropped.
+    // if the policy rejects new elements, nothing is inserted (and end() is returned) unless all of them fit.
+    iterator insert(const_iterator pos, const_iterator first, const_iterator last) {
+        return ref().insert(pos, first, last);
+    }
+
+    iterator insert(const_iterator pos, const T& val) {
+        return ref().insert(pos, val);
+    }
+
+    iterator insert(const_iterator pos, T&& val) {
+        return ref().insert(pos, container::detail::move(val));
+    }
+
+    // https://en.cppreference.com/w/cpp/container/vector/emplace
+    // args must not refer to the elements of this vector (they may be shifted before construction)
+    template <class... Args>
+    iterator emplace(const_iterator pos, Args&&... args) {
+        return ref().emplace(pos, container::detail::forward<Args>(args)...);
+    }
+
+    // reference which doesn't depend on N (see vector_ref)
+    operator vector_ref<T, Storage, Overflow>() {
+        return ref();
+    }
+
 private:
-    using RingBuffer<T, N>::pop;
-    using RingBuffer<T, N>::pop_front;
-    using RingBuffer<T, N>::push;
-    using RingBuffer<T, N>::push_front;
-    using RingBuffer<T, N>::emplace;
-    using RingBuffer<T, N>::fill;
+    // insert/erase/resize/assign and overflow are implemented once for all N in vector_ref
+    vector_ref<T, Storage, Overflow> ref() {
+        return vector_ref<T, Storage, Overflow>(this->buffer(), size_, N, static_cast<counter&>(*this));
+    }
+
+    void move_from(vector& r) {
+        if (container::detail::is_trivially_copyable<T>::value) {
+            ref().assign(r.begin(), r.end());
+        } else {
+            for (size_t i = 0; i < r.size(); ++i)
+                storage::put(data() + i, container::detail::move(r[i]));
+            size_ = r.size();
+        }
+        r.clear();
+    }
 };
 
 } // namespace arx
 } // namespace stdx
 
+template <typename T, size_t N, typename S, typename O>
+inline bool operator==(const arx::stdx::vector<T, N, S, O>& x, const arx::stdx::vector<T, N, S, O>& y) {
+    if (x.size() != y.size()) return false;
+    for (size_t i = 0; i < x.size(); ++i)
+        if (x[i] != y[i]) return false;
+    return true;
+}
+
+template <typename T, size_t N, typename S, typename O>
+inline bool operator!=(const arx::stdx::vector<T, N, S, O>& x, const arx::stdx::vector<T, N, S, O>& y) {
+    return !(x == y);
+}
+
 namespace arx {
 namespace stdx {
 
-template <typename T, size_t N>
-struct array : public RingBuffer<T, N> {
-    using iterator = typename RingBuffer<T, N>::iterator;
-    using const_iterator = typename RingBuffer<T, N>::const_iterator;
+// aggregate of N elements as std::array: no index or size is stored and element access is a plain index,
+// and it can be constexpr (e.g. a lookup table which is evaluated at compile time).
+// Storage is ignored (all N elements always exist) and kept for compatibility.
+template <typename T, size_t N, typename Storage = container::initialized_storage>
+struct array {
+    // public to be an aggregate: array<int, 3> arr {1, 2, 3};
+    T elems_[N ? N : 1];
 
-    array()
-    : RingBuffer<T, N>() {}
-    array(std::initializer_list<T> lst)
-    : RingBuffer<T, N>(lst) {}
+    using value_type = T;
+    using iterator = T*;
+    using const_iterator = const T*;
 
-    // copy
-    array(const array& r)
-    : RingBuffer<T, N>(r) {}
+    constexpr size_t size() const { return N; }
+    constexpr size_t max_size() const { return N; }
+    constexpr bool empty() const { return N == 0; }
 
-    array& operator=(const array& r) {
-        RingBuffer<T, N>::operator=(r);
-        return *this;
-    }
+    T& operator[](const size_t i) { return elems_[i]; }
+    constexpr const T& operator[](const size_t i) const { return elems_[i]; }
 
-    // move
-    array(array&& r)
-    : RingBuffer<T, N>(r) {}
+    T& front() { return elems_[0]; }
+    constexpr const T& front() const { return elems_[0]; }
+    T& back() { return elems_[N - 1]; }
+    constexpr const T& back() const { return elems_[N - 1]; }
 
-    array& operator=(array&& r) {
-        RingBuffer<T, N>::operator=(r);
-        return *this;
+    T* data() { return elems_; }
+    constexpr const T* data() const { return elems_; }
+
+    iterator begin() { return elems_; }
+    iterator end() { return elems_ + N; }
+    constexpr const_iterator begin() const { return elems_; }
+    constexpr const_iterator end() const { return elems_ + N; }
+
+    void fill(const T& v) {
+        for (size_t i = 0; i < N; ++i) elems_[i] = v;
     }
 
-private:
-    using RingBuffer<T, N>::pop;
-    using RingBuffer<T, N>::pop_front;
-    using RingBuffer<T, N>::push;
-    using RingBuffer<T, N>::push_front;
-    using RingBuffer<T, N>::emplace;
+    void swap(array& r) {
+        for (size_t i = 0; i < N; ++i) {
+            T t(container::detail::move(elems_[i]));
+            elems_[i] = container::detail::move(r.elems_[i]);
+            r.elems_[i] = container::detail::move(t);
+        }
+    }
 };
 
 } // namespace arx
 } // namespace stdx
 
+template <typename T, size_t N, typename S>
+inline bool operator==(const arx::stdx::array<T, N, S>& x, const arx::stdx::array<T, N, S>& y) {
+    for (size_t i = 0; i < N; ++i)
+        if (x[i] != y[i]) return false;
+    return true;
+}
+
+template <typename T, size_t N, typename S>
+inline bool operator!=(const arx::stdx::array<T, N, S>& x, const arx::stdx::array<T, N, S>& y) {
+    return !(x == y);
+}
+
 namespace arx {
 namespace stdx {
 
-template <typename T, size_t N = ARX_DEQUE_DEFAULT_SIZE>
-struct deque : public RingBuffer<T, N> {
-    using iterator = typename RingBuffer<T, N>::iterator;
-    using const_iterator = typename RingBuffer<T, N>::const_iterator;
+template <typename T, size_t N = ARX_DEQUE_DEFAULT_SIZE,
+          typename Storage = container::initialized_storage,
+          typename Overflow = container::overflow::overwrite>
+struct deque : public RingBuffer<T, N, Storage, Overflow> {
+    using iterator = typename RingBuffer<T, N, Storage, Overflow>::iterator;
+    using const_iterator = typename RingBuffer<T, N, Storage, Overflow>::const_iterator;
 
     deque()
-    : RingBuffer<T, N>() {}
+    : RingBuffer<T, N, Storage, Overflow>() {}
     deque(std::initializer_list<T> lst)
-    : RingBuffer<T, N>(lst) {}
+    : RingBuffer<T, N, Storage, Overflow>(lst) {}
 
     // copy
     deque(const deque& r)
-    : RingBuffer<T, N>(r) {}
+    : RingBuffer<T, N, Storage, Overflow>(r) {}
 
     deque& operator=(const deque& r) {
-        RingBuffer<T, N>::operator=(r);
+        RingBuffer<T, N, Storage, Overflow>::operator=(r);
         return *this;
     }
 
     // move
     deque(deque&& r)
-    : RingBuffer<T, N>(r) {}
+    : RingBuffer<T, N, Storage, Overflow>(container::detail::move(r)) {}
 
     deque& operator=(deque&& r) {
-        RingBuffer<T, N>::operator=(r);
+        RingBuffer<T, N, Storage, Overflow>::operator=(container::detail::move(r));
         return *this;
     }
 
 private:
-    using RingBuffer<T, N>::capacity;
-    using RingBuffer<T, N>::pop;
-    using RingBuffer<T, N>::push;
-    using RingBuffer<T, N>::fill;
+    using RingBuffer<T, N, Storage, Overflow>::capacity;
+    using RingBuffer<T, N, Storage, Overflow>::pop;
+    using RingBuffer<T, N, Storage, Overflow>::push;
+    using RingBuffer<T, N, Storage, Overflow>::fill;
 };
 
+// more specialized than the generic std::swap, which would be an exact match for deque as well
+template <typename T, size_t N, typename S, typename O>
+inline void swap(deque<T, N, S, O>& x, deque<T, N, S, O>& y) {
+    x.swap(y);
+}
+
+// std::swap(x, y) finds this through arx::stdx if there is no std::swap
+using ::arx::swap;
+
 } // namespace arx
 } // namespace stdx
 
@@ -717,6 +1463,19 @@ template <class T1, class T2>
 struct pair {
     T1 first;
     T2 second;
+
+    // constexpr so that tables of pairs (e.g. constexpr_map) can be constant-initialized
+    constexpr pair()
+    : first(), second() {}
+    constexpr pair(const T1& t1, const T2& t2)
+    : first(t1), second(t2) {}
+    template <class U1, class U2>
+    constexpr pair(U1&& u1, U2&& u2)
+    : first(container::detail::forward<U1>(u1)), second(container::detail::forward<U2>(u2)) {}
+    // construct second in place from args
+    template <class U1, class... Args>
+    constexpr pair(container::detail::in_place_key_t, U1&& u1, Args&&... args)
+    : first(container::detail::forward<U1>(u1)), second(container::detail::forward<Args>(args)...) {}
 };
 
 template <class T1, class T2>
@@ -740,9 +1499,11 @@ inline bool operator!=(const arx::stdx::pair<T1, T2>& x, const arx::stdx::pair<T
 namespace arx {
 namespace stdx {
 
-template <class Key, class T, size_t N = ARX_MAP_DEFAULT_SIZE>
-struct map : public RingBuffer<pair<Key, T>, N> {
-    using base = RingBuffer<pair<Key, T>, N>;
+template <class Key, class T, size_t N = ARX_MAP_DEFAULT_SIZE,
+          typename Storage = container::initialized_storage,
+          typename Overflow = container::overflow::overwrite>
+struct map : public RingBuffer<pair<Key, T>, N, Storage, Overflow> {
+    using base = RingBuffer<pair<Key, T>, N, Storage, Overflow>;
     using iterator = typename base::iterator;
     using const_iterator = typename base::const_iterator;
 
@@ -762,10 +1523,10 @@ struct map : public RingBuffer<pair<Key, T>, N> {
 
     // move
     map(map&& r)
-    : base(r) {}
+    : base(container::detail::move(r)) {}
 
     map& operator=(map&& r) {
-        base::operator=(r);
+        base::operator=(container::detail::move(r));
         return *this;
     }
 
@@ -793,7 +1554,18 @@ struct map : public RingBuffer<pair<Key, T>, N> {
         bool b {false};
         iterator it = find(p.first);
         if (it == this->end()) {
-            this->push(p);
+            if (this->push(p) == container::push_result::rejected) return {it, false};
+            b = true;
+            it = this->begin() + this->size() - 1;
+        }
+        return {it, b};
+    }
+
+    pair<iterator, bool> insert(pair<Key, T>&& p) {
+        bool b {false};
+        iterator it = find(p.first);
+        if (it == this->end()) {
+            if (this->push(container::detail::move(p)) == container::push_result::rejected) return {it, false};
             b = true;
             it = this->begin() + this->size() - 1;
         }
@@ -808,6 +1580,43 @@ struct map : public RingBuffer<pair<Key, T>, N> {
         return insert(p);
     }
 
+    pair<iterator, bool> emplace(pair<Key, T>&& p) {
+        return insert(container::detail::move(p));
+    }
+
+    // construct the mapped value in its slot only if the key does not exist
+    // if the map is full and the policy rejects new elements, {end(), false} is returned
+    template <class... Args>
+    pair<iterator, bool> try_emplace(const Key& key, Args&&... args) {
+        iterator it = find(key);
+        if (it != this->end()) return {it, false};
+        if (base::emplace_back(container::detail::in_place_key_t(), key, container::detail::forward<Args>(args)...) == container::push_result::rejected)
+            return {this->end(), false};
+        return {this->begin() + this->size() - 1, true};
+    }
+
+    template <class... Args>
+    pair<iterator, bool> try_emplace(Key&& key, Args&&... args) {
+        iterator it = find(key);
+        if (it != this->end()) return {it, false};
+        if (base::emplace_back(container::detail::in_place_key_t(), container::detail::move(key), container::detail::forward<Args>(args)...) == container::push_result::rejected)
+            return {this->end(), false};
+        return {this->begin() + this->size() - 1, true};
+    }
+
+    // assign to the mapped value if the key exists, otherwise insert it (with a single lookup)
+    template <class M>
+    pair<iterator, bool> insert_or_assign(const Key& key, M&& obj) {
+        iterator it = find(key);
+        if (it != this->end()) {
+            it->second = container::detail::forward<M>(obj);
+            return {it, false};
+        }
+        if (base::emplace_back(container::detail::in_place_key_t(), key, container::detail::forward<M>(obj)) == container::push_result::rejected)
+            return {this->end(), false};
+        return {this->begin() + this->size() - 1, true};
+    }
+
 private:
     T& empty_value() const {
         static T val;
@@ -830,8 +1639,7 @@ public:
     }
 
     iterator erase(const const_iterator& it) {
-        iterator i = find(it->first);
-        return base::erase(i);
+        return base::erase(it);
     }
 
     iterator erase(const Key& key) {
@@ -849,12 +1657,11 @@ public:
         return this->end();
     }
 
+    // if the key can't be added because of the policy, a fresh empty value is returned
     T& operator[](const Key& key) {
-        iterator it = find(key);
-        if (it != this->end()) return it->second;
-
-        insert(::arx::stdx::make_pair(key, T()));
-        return this->back().second;
+        iterator it = try_emplace(key).first;
+        if (it == this->end()) return empty_value();
+        return it->second;
     }
 
 private:
@@ -878,7 +1685,24 @@ private:
 } //  namespace stdx
 } // namespace arx
 
-template <typename T, size_t N>
-using ArxRingBuffer = arx::RingBuffer<T, N>;
+template <typename T, size_t N,
+          typename Storage = arx::container::initialized_storage,
+          typename Overflow = arx::container::overflow::overwrite>
+using ArxRingBuffer = arx::RingBuffer<T, N, Storage, Overflow>;
+
+#include "ArxContainer/spsc_ringbuffer.h"
+#include "ArxContainer/mpmc_ringbuffer.h"
+#include "ArxContainer/windowed_ring.h"
+#include "ArxContainer/span.h"
+#include "ArxContainer/constexpr_map.h"
+#include "ArxContainer/hash.h"
+#include "ArxContainer/fixed_string.h"
+#include "ArxContainer/unordered.h"
+#include "ArxContainer/ordered.h"
+#include "ArxContainer/flat_map.h"
+#include "ArxContainer/priority_queue.h"
+#include "ArxContainer/list.h"
+#include "ArxContainer/bitset.h"
+#include "ArxContainer/allocator.h"
 
 #endif  // ARX_RINGBUFFER_H
@@ -0,0 +1,309 @@
+#pragma once
+
+#ifndef ARX_CONTAINER_ALLOCATOR_H
+#define ARX_CONTAINER_ALLOCATOR_H
+
+// included from ArxContainer.h
+
+#if ARX_HAVE_LIBSTDCPLUSPLUS >= 201103L  // Have libstdc++11
+#include <new>
+#include <stdlib.h>
+#endif
+
+#if defined(ESP_PLATFORM) || defined(ARDUINO_ARCH_ESP32)
+#include <freertos/FreeRTOS.h>
+#elif defined(ARDUINO_ARCH_RP2040)
+#include <hardware/sync.h>
+#elif defined(__AVR__)
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#endif
+
+namespace arx {
+
+namespace container {
+    // usage counters of pool_allocator (in blocks) and monotonic_arena (in bytes)
+    struct allocator_stats {
+        size_t capacity;
+        size_t used;
+        size_t peak;
+        uint32_t allocations;
+        uint32_t failures;
+    };
+
+    namespace detail {
+        // standard containers can't handle nullptr from allocate():
+        // throw std::bad_alloc if exceptions are enabled, otherwise abort.
+        // without libstdc++ there is no standard container, so nullptr is returned
+        inline void* allocation_failed() {
+#if ARX_HAVE_LIBSTDCPLUSPLUS >= 201103L
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS)
+            throw std::bad_alloc();
+#else
+            abort();
+#endif
+#else
+            return nullptr;
+#endif
+        }
+
+        // critical section around block_pool, which is shared by all the containers
+        // using the same pool_allocator<T, Blocks> (e.g. in different tasks)
+#if defined(ESP_PLATFORM) || defined(ARDUINO_ARCH_ESP32)
+        // tasks on both cores: spinlock, with interrupts disabled on this core
+        struct pool_lock {
+            static portMUX_TYPE& mux() {
+                static portMUX_TYPE m = portMUX_INITIALIZER_UNLOCKED;
+                return m;
+            }
+            pool_lock() { portENTER_CRITICAL(&mux()); }
+            ~pool_lock() { portEXIT_CRITICAL(&mux()); }
+        };
+#elif defined(ARDUINO_ARCH_RP2040)
+        // both cores: hardware spinlock (one for general use), with interrupts disabled on this core
+        struct pool_lock {
+            uint32_t saved;
+            pool_lock()
+            : saved(spin_lock_blocking(spin_lock_instance(PICO_SPINLOCK_ID_STRIPED_FIRST))) {}
+            ~pool_lock() { spin_unlock(spin_lock_instance(PICO_SPINLOCK_ID_STRIPED_FIRST), saved); }
+        };
+#elif defined(__AVR__)
+        // single core: interrupts disabled
+        struct pool_lock {
+            uint8_t sreg;
+            pool_lock()
+            : sreg(SREG) {
+                cli();
+                __asm__ __volatile__("" ::: "memory");
+            }
+            ~pool_lock() {
+                __asm__ __volatile__("" ::: "memory");
+                SREG = sreg;
+            }
+        };
+#elif defined(__linux__) || defined(__APPLE__) || defined(_WIN32)
+        // host threads: spinlock (the OS preempts the holder, and the section is a few instructions)
+        struct pool_lock {
+            static bool& flag() {
+                static bool f = false;
+                return f;
+            }
+            pool_lock() {
+                while (__atomic_test_and_set(&flag(), __ATOMIC_ACQUIRE))
+                    ;
+            }
+            ~pool_lock() { __atomic_clear(&flag(), __ATOMIC_RELEASE); }
+        };
+#else
+        // other boards: no lock. a pool must not be used by more than one task (or a task and an ISR) at a time
+        struct pool_lock {};
+#endif
+
+        template <size_t Size, size_t Align>
+        union pool_block {
+            pool_block* next;
+            alignas(Align) unsigned char bytes[Size];
+        };
+
+        // Blocks blocks of T shared by all pool_allocator<T, Blocks>.
+        // blocks are taken in order until all of them have been used once, and then from the free list,
+        // so nothing has to be initialized at startup.
+        template <class T, size_t Blocks>
+        struct block_pool {
+            using block = pool_block<sizeof(T), alignof(T)>;
+
+            static block blocks_[Blocks];
+            static block* free_;
+            static size_t unused_;  // blocks_[unused_, Blocks) have never been allocated
+            static allocator_stats stats_;
+
+            static void* allocate(const size_t n) {
+                const pool_lock lock;
+                (void)lock;
+                block* b = nullptr;
+                if (n == 1) {
+                    if (free_) {
+                        b = free_;
+                        free_ = b->next;
+                    } else if (unused_ < Blocks) {
+                        b = &blocks_[unused_++];
+                    }
+                }
+                if (!b) {
+                    ++stats_.failures;
+                    return nullptr;
+                }
+                ++stats_.allocations;
+                if (++stats_.used > stats_.peak) stats_.peak = stats_.used;
+                return b;
+            }
+
+            static void deallocate(void* p) {
+                const pool_lock lock;
+                (void)lock;
+                block* b = static_cast<block*>(p);
+                b->next = free_;
+                free_ = b;
+                --stats_.used;
+            }
+        };
+
+        template <class T, size_t Blocks>
+        typename block_pool<T, Blocks>::block block_pool<T, Blocks>::blocks_[Blocks];
+        template <class T, size_t Blocks>
+        typename block_pool<T, Blocks>::block* block_pool<T, Blocks>::free_ = nullptr;
+        template <class T, size_t Blocks>
+        size_t block_pool<T, Blocks>::unused_ = 0;
+        template <class T, size_t Blocks>
+        allocator_stats block_pool<T, Blocks>::stats_ = {Blocks, 0, 0, 0, 0};
+    }  // namespace detail
+}  // namespace container
+
+// standard allocator which takes one T at a time from a static pool of Blocks blocks.
+// allocate() and deallocate() take O(1) and the pool never fragments.
+// for node based containers (std::list, std::map, std::set), which allocate one node at a time:
+// the container rebinds it to pool_allocator<Node, Blocks>, which has its own pool of Blocks nodes.
+// allocating n != 1 elements (e.g. std::vector) always fails (use monotonic_arena instead).
+// the pool is global: all containers with the same pool_allocator<T, Blocks> share its Blocks blocks and stats().
+// allocate() / deallocate() are guarded by a critical section on ESP32, RP2040, AVR (against ISRs) and hosts,
+// but not on other boards: there, give containers used by different tasks different Blocks (= different pools).
+template <class T, size_t Blocks>
+class pool_allocator {
+    using pool = container::detail::block_pool<T, Blocks>;
+
+public:
+    using value_type = T;
+
+    template <class U>
+    struct rebind {
+        using other = pool_allocator<U, Blocks>;
+    };
+
+    pool_allocator() = default;
+    template <class U>
+    pool_allocator(const pool_allocator<U, Blocks>&) {}
+
+    // on failure, throws std::bad_alloc or aborts (see allocation_failed())
+    T* allocate(const size_t n) {
+        T* p = try_allocate(n);
+        return p ? p : static_cast<T*>(container::detail::allocation_failed());
+    }
+    // nullptr on failure
+    T* try_allocate(const size_t n) {
+        return static_cast<T*>(pool::allocate(n));
+    }
+    void deallocate(T* p, const size_t) {
+        pool::deallocate(p);
+    }
+
+    static const container::allocator_stats& stats() { return pool::stats_; }
+};
+
+template <class T, class U, size_t Blocks>
+inline bool operator==(const pool_allocator<T, Blocks>&, const pool_allocator<U, Blocks>&) {
+    return true;
+}
+template <class T, class U, size_t Blocks>
+inline bool operator!=(const pool_allocator<T, Blocks>&, const pool_allocator<U, Blocks>&) {
+    return false;
+}
+
+// bump allocator on a buffer: allocate() only moves an offset forward,
+// deallocate() releases only the last allocation, and reset() releases everything at once.
+// use it through arena_allocator<T> for containers which are built and then dropped as a whole
+// (e.g. a std::vector after reserve(), or a std::map built per request).
+class monotonic_arena {
+    unsigned char* buf_;
+    size_t size_;
+    container::allocator_stats stats_;
+
+public:
+    monotonic_arena(void* buf, const size_t size)
+    : buf_(static_cast<unsigned char*>(buf)), size_(size), stats_ {size, 0, 0, 0, 0} {}
+    monotonic_arena(const monotonic_arena&) = delete;
+    monotonic_arena& operator=(const monotonic_arena&) = delete;
+
+    // nullptr if it doesn't fit (align must be a power of two)
+    void* allocate(const size_t bytes, const size_t align) {
+        const uintptr_t base = reinterpret_cast<uintptr_t>(buf_);
+        const size_t offset = static_cast<size_t>(((base + stats_.used + align - 1) & ~static_cast<uintptr_t>(align - 1)) - base);
+        if (offset > size_ || bytes > size_ - offset) {
+            ++stats_.failures;
+            return nullptr;
+        }
+        stats_.used = offset + bytes;
+        if (stats_.used > stats_.peak) stats_.peak = stats_.used;
+        ++stats_.allocations;
+        return buf_ + offset;
+    }
+
+    void deallocate(void* p, const size_t bytes) {
+        if (static_cast<unsigned char*>(p) + bytes == buf_ + stats_.used)
+            stats_.used = static_cast<size_t>(static_cast<unsigned char*>(p) - buf_);
+    }
+
+    // everything allocated from this arena must not be used anymore
+    void reset() { stats_.used = 0; }
+
+    size_t capacity() const { return size_; }
+    size_t used() const { return stats_.used; }
+    const container::allocator_stats& stats() const { return stats_; }
+};
+
+// monotonic_arena with its own buffer of Bytes
+template <size_t Bytes>
+class static_arena : public monotonic_arena {
+    unsigned char buf_[Bytes];
+
+public:
+    static_arena()
+    : monotonic_arena(buf_, Bytes) {}
+};
+
+// standard allocator which allocates from a monotonic_arena
+template <class T>
+class arena_allocator {
+    template <class U>
+    friend class arena_allocator;
+
+    monotonic_arena* arena_;
+
+public:
+    using value_type = T;
+
+    template <class U>
+    struct rebind {
+        using other = arena_allocator<U>;
+    };
+
+    arena_allocator(monotonic_arena& a)
+    : arena_(&a) {}
+    template <class U>
+    arena_allocator(const arena_allocator<U>& r)
+    : arena_(r.arena_) {}
+
+    // on failure, throws std::bad_alloc or aborts (see allocation_failed())
+    T* allocate(const size_t n) {
+        T* p = try_allocate(n);
+        return p ? p : static_cast<T*>(container::detail::allocation_failed());
+    }
+    // nullptr on failure
+    T* try_allocate(const size_t n) {
+        if (n > SIZE_MAX / sizeof(T)) return static_cast<T*>(arena_->allocate(SIZE_MAX, alignof(T)));
+        return static_cast<T*>(arena_->allocate(n * sizeof(T), alignof(T)));
+    }
+    void deallocate(T* p, const size_t n) {
+        arena_->deallocate(p, n * sizeof(T));
+    }
+
+    monotonic_arena& arena() const { return *arena_; }
+
+    template <class U>
+    bool operator==(const arena_allocator<U>& r) const { return arena_ == r.arena_; }
+    template <class U>
+    bool operator!=(const arena_allocator<U>& r) const { return arena_ != r.arena_; }
+};
+
+}  // namespace arx
+
+#endif  // ARX_CONTAINER_ALLOCATOR_H
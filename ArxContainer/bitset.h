@@ -0,0 +1,594 @@
+#pragma once
+
+#ifndef ARX_CONTAINER_BITSET_H
+#define ARX_CONTAINER_BITSET_H
+
+// included from ArxContainer.h
+
+namespace arx {
+
+namespace container {
+    namespace detail {
+        // word of the bit containers: a byte on 8-bit AVR (int is 16 bits), 32 bits elsewhere
+        using bit_word = typename conditional<(sizeof(int) < 4), uint8_t, uint32_t>::type;
+        constexpr size_t bit_word_bits = sizeof(bit_word) * 8;
+
+        inline size_t popcount(const bit_word w) {
+            return static_cast<size_t>(__builtin_popcount(w));
+        }
+        // position of the lowest set bit (w must not be 0)
+        inline size_t lowest_bit(const bit_word w) {
+            return static_cast<size_t>(__builtin_ctz(w));
+        }
+
+        // N bits packed in words. the bits at and above the logical size n are always 0,
+        // so whole words can be counted, scanned and compared without masking.
+        // operations take n (N for bitset, size() for vector<bool>) and touch only the words holding [0, n).
+        template <size_t N>
+        struct bit_array {
+            static constexpr size_t word_count = N ? (N + bit_word_bits - 1) / bit_word_bits : 1;
+
+            bit_word words_[word_count];
+
+            bit_array()
+            : words_() {}
+
+            static size_t words_for(const size_t n) { return (n + bit_word_bits - 1) / bit_word_bits; }
+            static size_t word_index(const size_t pos) { return pos / bit_word_bits; }
+            static bit_word bit_mask(const size_t pos) { return static_cast<bit_word>(bit_word(1) << (pos % bit_word_bits)); }
+            // bits below pos in its word
+            static bit_word low_mask(const size_t pos) { return static_cast<bit_word>(bit_mask(pos) - 1); }
+
+            bool test(const size_t pos) const { return (words_[word_index(pos)] & bit_mask(pos)) != 0; }
+            void set(const size_t pos, const bool v) {
+                if (v)
+                    words_[word_index(pos)] |= bit_mask(pos);
+                else
+                    words_[word_index(pos)] &= static_cast<bit_word>(~bit_mask(pos));
+            }
+            void flip(const size_t pos) { words_[word_index(pos)] ^= bit_mask(pos); }
+
+            // clear the bits at and above n in the last word
+            void trim(const size_t n) {
+                if (n % bit_word_bits) words_[word_index(n)] &= low_mask(n);
+            }
+            void reset_all() { memset(words_, 0, sizeof(words_)); }
+            // bits [0, n) are v and the rest are 0
+            void fill(const size_t n, const bool v) {
+                reset_all();
+                if (!v) return;
+                memset(words_, 0xFF, words_for(n) * sizeof(bit_word));
+                trim(n);
+            }
+            void flip_all(const size_t n) {
+                for (size_t i = 0; i < words_for(n); ++i) words_[i] = static_cast<bit_word>(~words_[i]);
+                trim(n);
+            }
+
+            size_t count(const size_t n) const {
+                size_t c = 0;
+                for (size_t i = 0; i < words_for(n); ++i) c += popcount(words_[i]);
+                return c;
+            }
+            bool any(const size_t n) const {
+                for (size_t i = 0; i < words_for(n); ++i)
+                    if (words_[i]) return true;
+                return false;
+            }
+            bool all(const size_t n) const {
+                const size_t full = n / bit_word_bits;
+                for (size_t i = 0; i < full; ++i)
+                    if (words_[i] != static_cast<bit_word>(~bit_word(0))) return false;
+                return (n % bit_word_bits) == 0 || words_[full] == low_mask(n);
+            }
+            // first set bit at or after pos, or n if there is none
+            size_t find_from(const size_t pos, const size_t n) const {
+                if (pos >= n) return n;
+                size_t i = word_index(pos);
+                bit_word w = static_cast<bit_word>(words_[i] & ~low_mask(pos));
+                const size_t words = words_for(n);
+                while (true) {
+                    if (w) return i * bit_word_bits + lowest_bit(w);
+                    if (++i == words) return n;
+                    w = words_[i];
+                }
+            }
+            bool equal(const bit_array& r, const size_t n) const {
+                return memcmp(words_, r.words_, words_for(n) * sizeof(bit_word)) == 0;
+            }
+
+            // bits of r at and above n must be 0 (or are cleared by trim)
+            void and_with(const bit_array& r, const size_t n) {
+                for (size_t i = 0; i < words_for(n); ++i) words_[i] &= r.words_[i];
+            }
+            void or_with(const bit_array& r, const size_t n) {
+                for (size_t i = 0; i < words_for(n); ++i) words_[i] |= r.words_[i];
+                trim(n);
+            }
+            void xor_with(const bit_array& r, const size_t n) {
+                for (size_t i = 0; i < words_for(n); ++i) words_[i] ^= r.words_[i];
+                trim(n);
+            }
+
+            // bit i moves to i + s (bits shifted out of [0, n) are lost)
+            void shift_up(const size_t s, const size_t n) {
+                if (s == 0) return;
+                if (s >= n) return reset_all();
+                const size_t ws = s / bit_word_bits;
+                const size_t bs = s % bit_word_bits;
+                for (size_t i = words_for(n); i-- > 0;) {
+                    bit_word w = 0;
+                    if (i >= ws) {
+                        w = static_cast<bit_word>(words_[i - ws] << bs);
+                        if (bs && i > ws) w |= static_cast<bit_word>(words_[i - ws - 1] >> (bit_word_bits - bs));
+                    }
+                    words_[i] = w;
+                }
+                trim(n);
+            }
+            // bit i moves to i - s (bits below s are lost)
+            void shift_down(const size_t s, const size_t n) {
+                if (s == 0) return;
+                if (s >= n) return reset_all();
+                const size_t ws = s / bit_word_bits;
+                const size_t bs = s % bit_word_bits;
+                const size_t words = words_for(n);
+                for (size_t i = 0; i < words; ++i) {
+                    bit_word w = 0;
+                    if (i + ws < words) {
+                        w = static_cast<bit_word>(words_[i + ws] >> bs);
+                        if (bs && i + ws + 1 < words) w |= static_cast<bit_word>(words_[i + ws + 1] << (bit_word_bits - bs));
+                    }
+                    words_[i] = w;
+                }
+            }
+
+            // remove the k bits [pos, pos + k) of [0, n): the bits above them move down by k (one pass over the words)
+            void erase(const size_t pos, const size_t k, const size_t n) {
+                const size_t i0 = word_index(pos);
+                const size_t words = words_for(n);
+                const size_t ws = k / bit_word_bits;
+                const size_t bs = k % bit_word_bits;
+                const bit_word low = low_mask(pos);
+                for (size_t i = i0; i < words; ++i) {
+                    bit_word w = 0;
+                    if (i + ws < words) {
+                        w = static_cast<bit_word>(words_[i + ws] >> bs);
+                        if (bs && i + ws + 1 < words) w |= static_cast<bit_word>(words_[i + ws + 1] << (bit_word_bits - bs));
+                    }
+                    words_[i] = (i == i0) ? static_cast<bit_word>((words_[i] & low) | (w & ~low)) : w;
+                }
+            }
+            // insert v at pos of [0, n) (n < N): the bits at and above pos move up by one
+            void insert(const size_t pos, const size_t n, const bool v) {
+                const size_t i0 = word_index(pos);
+                const bit_word low = low_mask(pos);
+                for (size_t i = words_for(n + 1); i-- > i0;) {
+                    bit_word w = static_cast<bit_word>(words_[i] << 1);
+                    if (i > i0) w |= static_cast<bit_word>(words_[i - 1] >> (bit_word_bits - 1));
+                    words_[i] = (i == i0) ? static_cast<bit_word>((words_[i] & low) | (w & ~low)) : w;
+                }
+                set(pos, v);
+            }
+        };
+
+        // proxy to one bit (as std::bitset::reference)
+        template <size_t N>
+        class bit_reference {
+            bit_array<N>* bits_;
+            size_t pos_;
+
+        public:
+            bit_reference(bit_array<N>& bits, const size_t pos)
+            : bits_(&bits), pos_(pos) {}
+
+            operator bool() const { return bits_->test(pos_); }
+            bool operator~() const { return !bits_->test(pos_); }
+
+            bit_reference& operator=(const bool v) {
+                bits_->set(pos_, v);
+                return *this;
+            }
+            bit_reference& operator=(const bit_reference& r) {
+                bits_->set(pos_, static_cast<bool>(r));
+                return *this;
+            }
+            bit_reference& flip() {
+                bits_->flip(pos_);
+                return *this;
+            }
+        };
+
+        // what dereferencing a bit_iterator returns
+        template <size_t N, bool Const>
+        struct bit_access {
+            using type = bit_reference<N>;
+            static type get(bit_array<N>& bits, const size_t pos) { return type(bits, pos); }
+        };
+        template <size_t N>
+        struct bit_access<N, true> {
+            using type = bool;
+            static bool get(const bit_array<N>& bits, const size_t pos) { return bits.test(pos); }
+        };
+
+        // random access iterator over packed bits: *it is bool, or a bit_reference if not Const
+        template <size_t N, bool Const>
+        class bit_iterator {
+            template <size_t, bool>
+            friend class bit_iterator;
+
+            using bits_type = typename conditional<Const, const bit_array<N>, bit_array<N>>::type;
+            using access = bit_access<N, Const>;
+
+            bits_type* bits_ {nullptr};
+            size_t pos_ {0};
+
+        public:
+            bit_iterator() = default;
+            bit_iterator(bits_type& bits, const size_t pos)
+            : bits_(&bits), pos_(pos) {}
+            // iterator -> const_iterator
+            template <bool C>
+            bit_iterator(const bit_iterator<N, C>& it)
+            : bits_(it.bits_), pos_(it.pos_) {}
+
+            size_t index() const { return pos_; }
+
+            typename access::type operator*() const { return access::get(*bits_, pos_); }
+            typename access::type operator[](const int i) const { return access::get(*bits_, pos_ + i); }
+
+            bit_iterator& operator++() {
+                ++pos_;
+                return *this;
+            }
+            bit_iterator& operator--() {
+                --pos_;
+                return *this;
+            }
+            bit_iterator operator++(int) {
+                bit_iterator it = *this;
+                ++pos_;
+                return it;
+            }
+            bit_iterator operator--(int) {
+                bit_iterator it = *this;
+                --pos_;
+                return it;
+            }
+            bit_iterator& operator+=(const int i) {
+                pos_ += i;
+                return *this;
+            }
+            bit_iterator& operator-=(const int i) {
+                pos_ -= i;
+                return *this;
+            }
+            bit_iterator operator+(const int i) const { return bit_iterator(*this) += i; }
+            bit_iterator operator-(const int i) const { return bit_iterator(*this) -= i; }
+            int operator-(const bit_iterator& rhs) const { return static_cast<int>(pos_) - static_cast<int>(rhs.pos_); }
+
+            bool operator==(const bit_iterator& rhs) const { return pos_ == rhs.pos_ && bits_ == rhs.bits_; }
+            bool operator!=(const bit_iterator& rhs) const { return !(*this == rhs); }
+            bool operator<(const bit_iterator& rhs) const { return pos_ < rhs.pos_; }
+            bool operator>(const bit_iterator& rhs) const { return pos_ > rhs.pos_; }
+            bool operator<=(const bit_iterator& rhs) const { return pos_ <= rhs.pos_; }
+            bool operator>=(const bit_iterator& rhs) const { return pos_ >= rhs.pos_; }
+        };
+
+    }  // namespace detail
+}  // namespace container
+
+namespace stdx {
+
+// N bits packed into words (1 bit per flag instead of 1 byte) as std::bitset.
+// count/any/all and find_first/find_next work on a whole word at a time.
+// find_first() and find_next(pos) return size() if there is no more set bit (as _Find_first/_Find_next of libstdc++).
+// positions out of range are not checked (test() returns false).
+template <size_t N>
+class bitset {
+    using bits_type = container::detail::bit_array<N>;
+
+    bits_type bits_;
+
+public:
+    using reference = container::detail::bit_reference<N>;
+
+    bitset() {}
+    // the bits of val above N are ignored
+    bitset(unsigned long long val) {
+        for (size_t i = 0; i < N && i < sizeof(val) * 8; ++i)
+            if ((val >> i) & 1) bits_.set(i, true);
+    }
+
+    constexpr size_t size() const { return N; }
+
+    bool test(const size_t pos) const { return pos < N && bits_.test(pos); }
+    bool operator[](const size_t pos) const { return bits_.test(pos); }
+    reference operator[](const size_t pos) { return reference(bits_, pos); }
+
+    bitset& set() {
+        bits_.fill(N, true);
+        return *this;
+    }
+    bitset& set(const size_t pos, const bool v = true) {
+        if (pos < N) bits_.set(pos, v);
+        return *this;
+    }
+    bitset& reset() {
+        bits_.reset_all();
+        return *this;
+    }
+    bitset& reset(const size_t pos) {
+        return set(pos, false);
+    }
+    bitset& flip() {
+        bits_.flip_all(N);
+        return *this;
+    }
+    bitset& flip(const size_t pos) {
+        if (pos < N) bits_.flip(pos);
+        return *this;
+    }
+
+    size_t count() const { return bits_.count(N); }
+    bool any() const { return bits_.any(N); }
+    bool none() const { return !bits_.any(N); }
+    bool all() const { return bits_.all(N); }
+
+    size_t find_first() const { return bits_.find_from(0, N); }
+    // first set bit after pos
+    size_t find_next(const size_t pos) const { return bits_.find_from(pos + 1, N); }
+
+    bitset& operator&=(const bitset& r) {
+        bits_.and_with(r.bits_, N);
+        return *this;
+    }
+    bitset& operator|=(const bitset& r) {
+        bits_.or_with(r.bits_, N);
+        return *this;
+    }
+    bitset& operator^=(const bitset& r) {
+        bits_.xor_with(r.bits_, N);
+        return *this;
+    }
+    bitset& operator<<=(const size_t s) {
+        bits_.shift_up(s, N);
+        return *this;
+    }
+    bitset& operator>>=(const size_t s) {
+        bits_.shift_down(s, N);
+        return *this;
+    }
+    bitset operator~() const { return bitset(*this).flip(); }
+    bitset operator<<(const size_t s) const { return bitset(*this) <<= s; }
+    bitset operator>>(const size_t s) const { return bitset(*this) >>= s; }
+
+    bool operator==(const bitset& r) const { return bits_.equal(r.bits_, N); }
+    bool operator!=(const bitset& r) const { return !bits_.equal(r.bits_, N); }
+
+    // the bits above the width of the result are ignored
+    unsigned long to_ulong() const { return static_cast<unsigned long>(to_ullong()); }
+    unsigned long long to_ullong() const {
+        unsigned long long v = 0;
+        for (size_t i = find_first(); i < N && i < sizeof(v) * 8; i = find_next(i))
+            v |= 1ULL << i;
+        return v;
+    }
+};
+
+template <size_t N>
+inline bitset<N> operator&(const bitset<N>& x, const bitset<N>& y) {
+    return bitset<N>(x) &= y;
+}
+template <size_t N>
+inline bitset<N> operator|(const bitset<N>& x, const bitset<N>& y) {
+    return bitset<N>(x) |= y;
+}
+template <size_t N>
+inline bitset<N> operator^(const bitset<N>& x, const bitset<N>& y) {
+    return bitset<N>(x) ^= y;
+}
+
+// vector<bool> packs its flags into words as std::vector<bool>:
+// operator[] and iterators return a proxy (reference) instead of bool&, and there is no data().
+// besides the vector interface, it has the bulk operations of bitset on [0, size()).
+// Storage is ignored (the words are always initialized). Overflow is the same as vector.
+template <size_t N, typename Storage, typename Overflow>
+struct vector<bool, N, Storage, Overflow> : protected container::detail::drop_counter<Overflow::counts_drops> {
+protected:
+    using bits_type = container::detail::bit_array<N>;
+    using counter = container::detail::drop_counter<Overflow::counts_drops>;
+
+    using size_type = typename container::detail::least_uint<N>::type;
+
+    bits_type bits_;
+    size_type size_;
+
+public:
+    using value_type = bool;
+    using reference = container::detail::bit_reference<N>;
+    using const_reference = bool;
+    using iterator = container::detail::bit_iterator<N, false>;
+    using const_iterator = container::detail::bit_iterator<N, true>;
+
+    // number of elements lost by overflow (always 0 if the policy doesn't count)
+    using counter::dropped;
+    using counter::reset_dropped;
+
+    vector()
+    : size_(0) {}
+    vector(std::initializer_list<bool> lst)
+    : size_(0) {
+        for (auto it = lst.begin(); it != lst.end(); ++it)
+            push_back(*it);
+    }
+
+    // copy (the words are copied as they are)
+    vector(const vector& r) = default;
+    vector& operator=(const vector& r) = default;
+
+    // move (r is left empty as the other containers)
+    vector(vector&& r)
+    : counter(r), bits_(r.bits_), size_(r.size_) {
+        r.clear();
+    }
+    vector& operator=(vector&& r) {
+        if (this != &r) {
+            counter::operator=(r);
+            bits_ = r.bits_;
+            size_ = r.size_;
+            r.clear();
+        }
+        return *this;
+    }
+
+    size_t capacity() const { return N; }
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+
+    void clear() {
+        bits_.reset_all();
+        size_ = 0;
+    }
+
+    void pop_back() {
+        if (size_ == 0) return;
+        bits_.set(--size_, false);
+    }
+
+    // if full, the front one is dropped (or the new one, if the policy rejects new elements)
+    container::push_result push_back(const bool v) {
+        container::push_result r = container::push_result::ok;
+        if (size_ == N) {
+            counter::count_drop();
+            if (Overflow::rejects_new) return container::push_result::rejected;
+            bits_.erase(0, 1, size_--);
+            r = container::push_result::overwritten;
+        }
+        bits_.set(size_++, v);
+        return r;
+    }
+    container::push_result emplace_back(const bool v = false) {
+        return push_back(v);
+    }
+
+    bool front() const { return bits_.test(0); }
+    reference front() { return reference(bits_, 0); }
+
+    bool back() const { return bits_.test(size_ - 1); }
+    reference back() { return reference(bits_, size_ - 1); }
+
+    bool operator[](const size_t index) const { return bits_.test(index); }
+    reference operator[](const size_t index) { return reference(bits_, index); }
+
+    iterator begin() { return iterator(bits_, 0); }
+    iterator end() { return iterator(bits_, size_); }
+    const_iterator begin() const { return const_iterator(bits_, 0); }
+    const_iterator end() const { return const_iterator(bits_, size_); }
+
+    // https://en.cppreference.com/w/cpp/container/vector/erase
+    iterator erase(const_iterator pos) {
+        if (pos.index() >= size_) return end();
+        bits_.erase(pos.index(), 1, size_--);
+        return iterator(bits_, pos.index());
+    }
+
+    iterator erase(const_iterator first, const_iterator last) {
+        if (last.index() > size_ || first.index() >= last.index()) return end();
+        const size_t k = last.index() - first.index();
+        bits_.erase(first.index(), k, size_);
+        size_ = static_cast<size_type>(size_ - k);
+        return iterator(bits_, first.index());
+    }
+
+    // https://en.cppreference.com/w/cpp/container/vector/insert
+    // if full, the back one is dropped (or nothing is inserted and end() is returned, if the policy rejects new elements)
+    iterator insert(const_iterator pos, const bool v) {
+        if (pos.index() > size_) return end();
+        if (size_ == N) {
+            counter::count_drop();
+            if (Overflow::rejects_new) return end();
+            if (pos.index() == N) return end();
+            pop_back();
+        }
+        bits_.insert(pos.index(), size_++, v);
+        return iterator(bits_, pos.index());
+    }
+
+    // if sz exceeds the capacity, the front ones are dropped (or sz is clamped, if the policy rejects new elements)
+    void resize(size_t sz, const bool v = false) {
+        if (sz > N) {
+            counter::count_drop(sz - N);
+            if (!Overflow::rejects_new) {
+                const size_t drop = sz - N;
+                bits_.shift_down(drop < size_ ? drop : size_, size_);
+                size_ = static_cast<size_type>(drop < size_ ? size_ - drop : 0);
+            }
+            sz = N;
+        }
+        while (size_ > sz) pop_back();
+        while (size_ < sz) bits_.set(size_++, v);
+    }
+
+    // the range may be a part of this vector, so it is read into a temporary first
+    // (only the bits are taken over: the drop counter keeps counting)
+    void assign(const_iterator first, const_iterator last) {
+        vector r;
+        for (; first != last; ++first) r.push_back(*first);
+        bits_ = r.bits_;
+        size_ = r.size_;
+    }
+    void assign(size_t n, const bool v) {
+        if (n > N) {
+            counter::count_drop(n - N);
+            n = N;
+        }
+        bits_.fill(n, v);
+        size_ = static_cast<size_type>(n);
+    }
+
+    void shrink_to_fit() {
+        // dummy
+    }
+
+    void reserve(size_t n) {
+        (void)n;
+        // dummy
+    }
+
+    // bulk operations on [0, size()), word by word
+    void flip() { bits_.flip_all(size_); }
+    size_t count() const { return bits_.count(size_); }
+    bool any() const { return bits_.any(size_); }
+    bool none() const { return !bits_.any(size_); }
+    bool all() const { return bits_.all(size_); }
+    // size() if there is no more set bit
+    size_t find_first() const { return bits_.find_from(0, size_); }
+    size_t find_next(const size_t pos) const { return bits_.find_from(pos + 1, size_); }
+
+    // the elements of r beyond r.size() are false, and size() doesn't change
+    vector& operator&=(const vector& r) {
+        bits_.and_with(r.bits_, size_);
+        return *this;
+    }
+    vector& operator|=(const vector& r) {
+        bits_.or_with(r.bits_, size_);
+        return *this;
+    }
+    vector& operator^=(const vector& r) {
+        bits_.xor_with(r.bits_, size_);
+        return *this;
+    }
+
+    friend bool operator==(const vector& x, const vector& y) {
+        return x.size_ == y.size_ && x.bits_.equal(y.bits_, x.size_);
+    }
+    friend bool operator!=(const vector& x, const vector& y) {
+        return !(x == y);
+    }
+};
+
+}  // namespace stdx
+}  // namespace arx
+
+#endif  // ARX_CONTAINER_BITSET_H
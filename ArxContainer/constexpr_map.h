@@ -0,0 +1,241 @@
+#pragma once
+
+#ifndef ARX_CONTAINER_CONSTEXPR_MAP_H
+#define ARX_CONTAINER_CONSTEXPR_MAP_H
+
+// included from ArxContainer.h
+
+#ifdef __AVR__
+#include <avr/pgmspace.h>
+#endif
+
+namespace arx {
+
+namespace container {
+    namespace detail {
+        // copy an object out of flash (PROGMEM) on AVR, where flash is not in the data address space.
+        // other boards read flash (const data) directly.
+        // T must be trivially copyable.
+        template <class T>
+        inline T progmem_read(const T* p) {
+#ifdef __AVR__
+            T v;
+            memcpy_P(static_cast<void*>(&v), p, sizeof(T));
+            return v;
+#else
+            return *p;
+#endif
+        }
+
+        // default comparator of constexpr_map (std::less is constexpr only since C++14)
+        template <class T>
+        struct constexpr_less {
+            constexpr bool operator()(const T& x, const T& y) const { return x < y; }
+        };
+    }  // namespace detail
+}  // namespace container
+
+namespace stdx {
+
+// sorted table of N key/value pairs as an aggregate, which can be constexpr:
+//   constexpr arx::stdx::constexpr_map<uint8_t, uint16_t, 3> baud {{{1, 96}, {2, 192}, {3, 384}}};
+//   static_assert(baud.is_sorted(), "");
+//   static_assert(baud.at(2) == 192, "");
+// keys must be sorted by Compare (and unique). find() / at() are binary searches,
+// which are evaluated at compile time if the map and the key are constant and Compare is constexpr.
+// to keep the table in flash on AVR, define it PROGMEM and read it through progmem_map.
+template <class Key, class T, size_t N, class Compare = container::detail::constexpr_less<Key>>
+struct constexpr_map {
+    // public to be an aggregate
+    pair<Key, T> entries_[N ? N : 1];
+
+    using key_type = Key;
+    using mapped_type = T;
+    using value_type = pair<Key, T>;
+    using const_iterator = const value_type*;
+    using iterator = const value_type*;
+
+    constexpr size_t size() const { return N; }
+    constexpr bool empty() const { return N == 0; }
+
+    constexpr const value_type& operator[](const size_t i) const { return entries_[i]; }
+    constexpr const_iterator begin() const { return entries_; }
+    constexpr const_iterator end() const { return entries_ + N; }
+
+    // index of the first entry whose key is not less than key
+    constexpr size_t lower_bound_index(const Key& key) const {
+        return lower_bound_index(key, 0, N);
+    }
+    // index of the entry of key, or size() if not found
+    constexpr size_t index_of(const Key& key) const {
+        return checked_index(lower_bound_index(key), key);
+    }
+    constexpr bool contains(const Key& key) const {
+        return index_of(key) != N;
+    }
+    constexpr const_iterator find(const Key& key) const {
+        return entries_ + index_of(key);
+    }
+    // T() if not found (as map::at)
+    constexpr T at(const Key& key) const {
+        return value_at(index_of(key));
+    }
+
+    // keys are sorted and unique
+    constexpr bool is_sorted(const size_t i = 1) const {
+        return i >= N || (Compare()(entries_[i - 1].first, entries_[i].first) && is_sorted(i + 1));
+    }
+
+private:
+    constexpr size_t lower_bound_index(const Key& key, const size_t first, const size_t n) const {
+        return n == 0 ? first
+             : Compare()(entries_[first + n / 2].first, key) ? lower_bound_index(key, first + n / 2 + 1, n - n / 2 - 1)
+                                                             : lower_bound_index(key, first, n / 2);
+    }
+    constexpr size_t checked_index(const size_t i, const Key& key) const {
+        return (i < N && !Compare()(key, entries_[i].first)) ? i : N;
+    }
+    constexpr T value_at(const size_t i) const {
+        return i < N ? entries_[i].second : T();
+    }
+};
+
+// read-only view of N elements in flash (PROGMEM): elements are copied out on each access.
+//   const uint16_t sine_P[256] PROGMEM = {...};
+//   auto sine = arx::stdx::make_progmem(sine_P);
+//   uint16_t v = sine[i];
+// only the pointer is stored in SRAM. T must be trivially copyable.
+template <class T, size_t N>
+class progmem_array {
+    const T* data_;
+
+public:
+    using value_type = T;
+
+    class const_iterator {
+        friend progmem_array;
+
+        const T* p {nullptr};
+
+        explicit const_iterator(const T* p)
+        : p(p) {}
+
+    public:
+        const_iterator() = default;
+
+        T operator*() const { return container::detail::progmem_read(p); }
+
+        const_iterator& operator++() {
+            ++p;
+            return *this;
+        }
+        const_iterator operator++(int) {
+            const_iterator it = *this;
+            ++p;
+            return it;
+        }
+
+        bool operator==(const const_iterator& rhs) const { return p == rhs.p; }
+        bool operator!=(const const_iterator& rhs) const { return p != rhs.p; }
+    };
+    using iterator = const_iterator;
+
+    constexpr progmem_array(const T (&arr)[N])
+    : data_(arr) {}
+    template <typename S>
+    constexpr progmem_array(const array<T, N, S>& arr)
+    : data_(arr.data()) {}
+
+    constexpr size_t size() const { return N; }
+    constexpr bool empty() const { return N == 0; }
+    // address in flash (use with memcpy_P etc.)
+    constexpr const T* data() const { return data_; }
+
+    T operator[](const size_t i) const { return container::detail::progmem_read(data_ + i); }
+    T front() const { return (*this)[0]; }
+    T back() const { return (*this)[N - 1]; }
+
+    const_iterator begin() const { return const_iterator(data_); }
+    const_iterator end() const { return const_iterator(data_ + N); }
+};
+
+// lookup in a constexpr_map defined in flash (PROGMEM): binary search which copies out only the keys it visits.
+//   const arx::stdx::constexpr_map<uint8_t, uint16_t, 3> baud_P PROGMEM {{{1, 96}, {2, 192}, {3, 384}}};
+//   auto baud = arx::stdx::make_progmem(baud_P);
+//   uint16_t v = baud.at(2);
+template <class Key, class T, size_t N, class Compare = container::detail::constexpr_less<Key>>
+class progmem_map {
+    using map_type = constexpr_map<Key, T, N, Compare>;
+
+    const typename map_type::value_type* entries_;
+
+    Key key_at(const size_t i) const { return container::detail::progmem_read(&entries_[i].first); }
+
+public:
+    using key_type = Key;
+    using mapped_type = T;
+    using value_type = typename map_type::value_type;
+
+    constexpr progmem_map(const map_type& m)
+    : entries_(m.entries_) {}
+
+    constexpr size_t size() const { return N; }
+    constexpr bool empty() const { return N == 0; }
+
+    value_type operator[](const size_t i) const { return container::detail::progmem_read(entries_ + i); }
+
+    // index of the first entry whose key is not less than key
+    size_t lower_bound_index(const Key& key) const {
+        size_t first = 0;
+        size_t n = N;
+        while (n > 0) {
+            const size_t half = n / 2;
+            if (Compare()(key_at(first + half), key)) {
+                first += half + 1;
+                n -= half + 1;
+            } else {
+                n = half;
+            }
+        }
+        return first;
+    }
+    // index of the entry of key, or size() if not found
+    size_t index_of(const Key& key) const {
+        const size_t i = lower_bound_index(key);
+        return (i < N && !Compare()(key, key_at(i))) ? i : N;
+    }
+    bool contains(const Key& key) const {
+        return index_of(key) != N;
+    }
+    // copy the value of key to v, or false if not found
+    bool find(const Key& key, T& v) const {
+        const size_t i = index_of(key);
+        if (i == N) return false;
+        v = container::detail::progmem_read(&entries_[i].second);
+        return true;
+    }
+    // T() if not found (as map::at)
+    T at(const Key& key) const {
+        T v = T();
+        find(key, v);
+        return v;
+    }
+};
+
+template <class T, size_t N>
+constexpr progmem_array<T, N> make_progmem(const T (&arr)[N]) {
+    return progmem_array<T, N>(arr);
+}
+template <class T, size_t N, typename S>
+constexpr progmem_array<T, N> make_progmem(const array<T, N, S>& arr) {
+    return progmem_array<T, N>(arr);
+}
+template <class Key, class T, size_t N, class Compare>
+constexpr progmem_map<Key, T, N, Compare> make_progmem(const constexpr_map<Key, T, N, Compare>& m) {
+    return progmem_map<Key, T, N, Compare>(m);
+}
+
+}  // namespace stdx
+}  // namespace arx
+
+#endif  // ARX_CONTAINER_CONSTEXPR_MAP_H
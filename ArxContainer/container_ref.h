@@ -0,0 +1,871 @@
+#pragma once
+
+#ifndef ARX_CONTAINER_CONTAINER_REF_H
+#define ARX_CONTAINER_CONTAINER_REF_H
+
+// included from ArxContainer.h
+
+namespace arx {
+
+template <typename T, size_t N, typename Storage, typename Overflow>
+class RingBuffer;
+
+namespace container {
+    namespace detail {
+        // reference to head_ or size_ of a RingBuffer, whose type depends on N
+        class index_ref {
+            void* p_;
+            uint8_t bytes_;
+
+        public:
+            template <typename Index>
+            explicit index_ref(Index& i)
+            : p_(&i), bytes_(sizeof(Index)) {}
+
+            size_t get() const {
+                if (bytes_ == 1) return *static_cast<const uint8_t*>(p_);
+                if (bytes_ == 2) return *static_cast<const uint16_t*>(p_);
+                return static_cast<size_t>(*static_cast<const uint32_t*>(p_));
+            }
+            void set(const size_t v) {
+                if (bytes_ == 1)
+                    *static_cast<uint8_t*>(p_) = static_cast<uint8_t>(v);
+                else if (bytes_ == 2)
+                    *static_cast<uint16_t*>(p_) = static_cast<uint16_t>(v);
+                else
+                    *static_cast<uint32_t*>(p_) = static_cast<uint32_t>(v);
+            }
+        };
+
+        // reference to the drop_counter of a container
+        template <bool Count>
+        class drop_counter_ref {
+            drop_counter<true>* counter_;
+
+        public:
+            explicit drop_counter_ref(drop_counter<true>& c)
+            : counter_(&c) {}
+
+            void count_drop(const size_t n = 1) { counter_->count_drop(n); }
+            uint32_t dropped() const { return counter_->dropped(); }
+            void reset_dropped() { counter_->reset_dropped(); }
+        };
+
+        template <>
+        struct drop_counter_ref<false> : drop_counter<false> {
+            explicit drop_counter_ref(drop_counter<false>&) {}
+        };
+    }  // namespace detail
+}  // namespace container
+
+namespace stdx {
+
+// reference to a vector of any capacity: vector<T, N, Storage, Overflow> converts to it.
+// a function taking vector_ref<T> is compiled only once for all N, and can modify the vector.
+// vector itself forwards insert/erase/resize/assign to it, so these are also compiled once for all N.
+template <typename T,
+          typename Storage = container::initialized_storage,
+          typename Overflow = container::overflow::overwrite>
+class vector_ref : protected container::detail::slot_ops<T, Storage>,
+                   protected container::detail::drop_counter_ref<Overflow::counts_drops> {
+    using storage = container::detail::slot_ops<T, Storage>;
+    using counter = container::detail::drop_counter_ref<Overflow::counts_drops>;
+
+    T* data_;
+    size_t* size_;
+    size_t capacity_;
+
+public:
+    using value_type = T;
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    vector_ref(T* data, size_t& size, const size_t capacity, container::detail::drop_counter<Overflow::counts_drops>& c)
+    : counter(c), data_(data), size_(&size), capacity_(capacity) {}
+
+    // number of elements lost by overflow (always 0 if the policy doesn't count)
+    using counter::dropped;
+    using counter::reset_dropped;
+
+    size_t capacity() const { return capacity_; }
+    size_t size() const { return *size_; }
+    bool empty() const { return *size_ == 0; }
+    const T* data() const { return data_; }
+    T* data() { return data_; }
+
+    void clear() {
+        for (size_t i = 0; i < *size_; ++i)
+            storage::destroy(data_ + i);
+        *size_ = 0;
+    }
+
+    void pop_back() {
+        if (*size_ == 0) return;
+        storage::destroy(data_ + *size_ - 1);
+        --*size_;
+    }
+
+    container::push_result push_back(const T& v) {
+        if (*size_ == capacity_) {
+            if (Overflow::rejects_new) return reject();
+            // v may refer to the element to be dropped
+            T t(v);
+            return overwrite_back(container::detail::move(t));
+        }
+        storage::put(data_ + (*size_)++, v);
+        return container::push_result::ok;
+    }
+    container::push_result push_back(T&& v) {
+        if (*size_ == capacity_) {
+            if (Overflow::rejects_new) return reject();
+            T t(container::detail::move(v));
+            return overwrite_back(container::detail::move(t));
+        }
+        storage::put(data_ + (*size_)++, container::detail::move(v));
+        return container::push_result::ok;
+    }
+    template <class... Args>
+    container::push_result emplace_back(Args&&... args) {
+        if (*size_ == capacity_) {
+            if (Overflow::rejects_new) return reject();
+            return overwrite_back(T(container::detail::forward<Args>(args)...));
+        }
+        storage::emplace(data_ + *size_, container::detail::forward<Args>(args)...);
+        ++*size_;
+        return container::push_result::ok;
+    }
+
+    const T& front() const { return data_[0]; }
+    T& front() { return data_[0]; }
+
+    const T& back() const { return data_[*size_ - 1]; }
+    T& back() { return data_[*size_ - 1]; }
+
+    const T& operator[](size_t index) const { return data_[index]; }
+    T& operator[](size_t index) { return data_[index]; }
+
+    iterator begin() { return data_; }
+    iterator end() { return data_ + *size_; }
+    const_iterator begin() const { return data_; }
+    const_iterator end() const { return data_ + *size_; }
+
+    // https://en.cppreference.com/w/cpp/container/vector/erase
+    iterator erase(const_iterator pos) {
+        if (pos < begin() || pos >= end()) return end();
+        return erase(pos, pos + 1);
+    }
+
+    iterator erase(const_iterator first, const_iterator last) {
+        if (first < begin() || last > end() || first >= last) return end();
+        T* dst = begin() + (first - begin());
+        const size_t n = last - first;
+        const size_t tail = end() - last;
+        if (container::detail::is_trivially_copyable<T>::value) {
+            memmove(static_cast<void*>(dst), static_cast<const void*>(dst + n), tail * sizeof(T));
+        } else {
+            for (size_t i = 0; i < tail; ++i)
+                dst[i] = container::detail::move(dst[i + n]);
+            for (size_t i = 0; i < n; ++i)
+                storage::destroy(dst + tail + i);
+        }
+        *size_ -= n;
+        return dst;
+    }
+
+    void resize(size_t sz) {
+        if (Overflow::rejects_new && sz > capacity_) sz = capacity_;
+        if (sz > capacity_) {
+            // same as pushing (sz - size()) elements: the front ones are dropped
+            const size_t drop = sz - capacity_ < *size_ ? sz - capacity_ : *size_;
+            counter::count_drop(sz - capacity_);
+            erase(begin(), begin() + drop);
+            sz = capacity_;
+        }
+        while (*size_ < sz) emplace_back();
+        while (*size_ > sz) pop_back();
+    }
+
+    // if the range is longer than the capacity, only the last capacity() elements are kept,
+    // or the first ones if the policy rejects new elements
+    void assign(const_iterator first, const_iterator last) {
+        clear();
+        const size_t n = last - first;
+        if (n > capacity_) {
+            counter::count_drop(n - capacity_);
+            if (Overflow::rejects_new)
+                last = first + capacity_;
+            else
+                first += n - capacity_;
+        }
+        append(first, last - first);
+    }
+
+    // https://en.cppreference.com/w/cpp/container/vector/insert
+    // if the result exceeds the capacity, elements after the inserted range are dropped,
+    // or, if the inserted range itself does not fit, the front elements are dropped.
+    // if the policy rejects new elements, nothing is inserted (and end() is returned) unless all of them fit.
+    iterator insert(const_iterator pos, const_iterator first, const_iterator last) {
+        if (pos < begin() || pos > end()) return end();
+
+        const size_t index = pos - begin();
+        const size_t sz = last - first;
+        if (Overflow::rejects_new && *size_ + sz > capacity_) {
+            reject(sz);
+            return end();
+        }
+        if (index + sz > capacity_) {
+            // keep the last capacity() elements of [begin(), pos) + [first, last)
+            counter::count_drop(*size_ + sz - capacity_);
+            while (*size_ > index) pop_back();
+            const size_t keep_src = sz < capacity_ ? sz : capacity_;
+            const size_t keep_old = capacity_ - keep_src < *size_ ? capacity_ - keep_src : *size_;
+            erase(begin(), begin() + (*size_ - keep_old));
+            append(last - keep_src, keep_src);
+            return begin() + (*size_ - keep_src);
+        }
+        const size_t live = open_gap(index, sz);
+        for (size_t i = 0; i < sz; ++i)
+            store_at(index + i, live, first[i]);
+        return begin() + index;
+    }
+
+    iterator insert(const_iterator pos, const T& val) {
+        if (pos < begin() || pos > end()) return end();
+        const size_t index = pos - begin();
+        if (index == capacity_) {
+            if (push_back(val) == container::push_result::rejected) return end();
+            return end() - 1;
+        }
+        if (Overflow::rejects_new && *size_ == capacity_) {
+            reject();
+            return end();
+        }
+        // val may refer to an element to be shifted
+        T v(val);
+        const size_t live = open_gap(index, 1);
+        store_at(index, live, container::detail::move(v));
+        return begin() + index;
+    }
+
+    iterator insert(const_iterator pos, T&& val) {
+        if (pos < begin() || pos > end()) return end();
+        const size_t index = pos - begin();
+        if (index == capacity_) {
+            if (push_back(container::detail::move(val)) == container::push_result::rejected) return end();
+            return end() - 1;
+        }
+        if (Overflow::rejects_new && *size_ == capacity_) {
+            reject();
+            return end();
+        }
+        const size_t live = open_gap(index, 1);
+        store_at(index, live, container::detail::move(val));
+        return begin() + index;
+    }
+
+    // https://en.cppreference.com/w/cpp/container/vector/emplace
+    // args must not refer to the elements of this vector (they may be shifted before construction)
+    template <class... Args>
+    iterator emplace(const_iterator pos, Args&&... args) {
+        if (pos < begin() || pos > end()) return end();
+        const size_t index = pos - begin();
+        if (index == capacity_ || *size_ == capacity_)
+            return insert(pos, T(container::detail::forward<Args>(args)...));
+        const size_t live = open_gap(index, 1);
+        if (index < live)
+            data_[index] = T(container::detail::forward<Args>(args)...);
+        else
+            storage::emplace(data_ + index, container::detail::forward<Args>(args)...);
+        return begin() + index;
+    }
+
+private:
+    container::push_result reject(const size_t n = 1) {
+        counter::count_drop(n);
+        return container::push_result::rejected;
+    }
+
+    // drop the front element and store v at the back
+    container::push_result overwrite_back(T&& v) {
+        counter::count_drop();
+        erase(begin());
+        storage::put(data_ + (*size_)++, container::detail::move(v));
+        return container::push_result::overwritten;
+    }
+
+    void append(const T* src, const size_t n) {
+        if (container::detail::is_trivially_copyable<T>::value) {
+            memcpy(static_cast<void*>(data_ + *size_), static_cast<const void*>(src), n * sizeof(T));
+            *size_ += n;
+        } else {
+            for (size_t i = 0; i < n; ++i)
+                storage::put(data_ + (*size_)++, src[i]);
+        }
+    }
+
+    // slots below live hold an element, others are free
+    template <class U>
+    void store_at(const size_t index, const size_t live, U&& v) {
+        if (index < live)
+            data_[index] = container::detail::forward<U>(v);
+        else
+            storage::put(data_ + index, container::detail::forward<U>(v));
+    }
+
+    // make room for sz elements at index (index + sz <= capacity) by shifting the following elements,
+    // and return the number of elements alive before the gap was opened (slots >= it are free).
+    // size is already advanced when returned, and the gap must be filled with store_at().
+    size_t open_gap(const size_t index, const size_t sz) {
+        // elements pushed out of the capacity are dropped
+        if (*size_ + sz > capacity_) counter::count_drop(*size_ + sz - capacity_);
+        while (*size_ + sz > capacity_) pop_back();
+        const size_t live = *size_;
+        if (container::detail::is_trivially_copyable<T>::value) {
+            memmove(static_cast<void*>(data_ + index + sz), static_cast<const void*>(data_ + index), (live - index) * sizeof(T));
+            *size_ += sz;
+            // the whole gap is overwritten bitwise, so it can be treated as free
+            return index;
+        }
+        for (size_t i = live + sz; i-- > index + sz;)
+            store_at(i, live, container::detail::move(data_[i - sz]));
+        *size_ += sz;
+        return live;
+    }
+};
+
+// reference to a RingBuffer (or deque) of any capacity: RingBuffer<T, N, Storage, Overflow> converts to it.
+// a function taking deque_ref<T> is compiled only once for all N, and can modify the buffer.
+// RingBuffer itself forwards insert/erase to it, so these are also compiled once for all N.
+// indices are wrapped with a comparison (no bit mask even if N is a power of two),
+// so RingBuffer's own push/pop/operator[] and bulk push/pop/peek are faster than the ones of deque_ref.
+template <typename T,
+          typename Storage = container::initialized_storage,
+          typename Overflow = container::overflow::overwrite>
+class deque_ref : protected container::detail::slot_ops<T, Storage>,
+                  protected container::detail::drop_counter_ref<Overflow::counts_drops> {
+    // RingBuffer validates the positions with its own iterators and calls the index based functions
+    template <typename, size_t, typename, typename>
+    friend class ::arx::RingBuffer;
+
+    using storage = container::detail::slot_ops<T, Storage>;
+    using counter = container::detail::drop_counter_ref<Overflow::counts_drops>;
+
+    template <typename U>
+    class basic_iterator {
+        friend deque_ref;
+        template <typename>
+        friend class basic_iterator;
+
+        U* buf {nullptr};
+        size_t cap {0};
+        int pos {0};  // position of the element in [0, 2 * cap)
+
+        basic_iterator(U* buf, const size_t cap, const int pos)
+        : buf(buf), cap(cap), pos(pos) {}
+
+        size_t index() const {
+            const size_t p = static_cast<size_t>(pos);
+            return (p >= cap) ? p - cap : p;
+        }
+
+    public:
+        basic_iterator() = default;
+        // iterator -> const_iterator
+        template <typename V>
+        basic_iterator(const basic_iterator<V>& it)
+        : buf(it.buf), cap(it.cap), pos(it.pos) {}
+
+        U& operator*() const { return buf[index()]; }
+        U* operator->() const { return buf + index(); }
+
+        basic_iterator operator+(const int n) const { return basic_iterator(buf, cap, pos + n); }
+        basic_iterator operator-(const int n) const { return basic_iterator(buf, cap, pos - n); }
+        int operator-(const basic_iterator& rhs) const { return pos - rhs.pos; }
+        basic_iterator& operator+=(const int n) {
+            pos += n;
+            return *this;
+        }
+        basic_iterator& operator-=(const int n) {
+            pos -= n;
+            return *this;
+        }
+        basic_iterator& operator++() {
+            ++pos;
+            return *this;
+        }
+        basic_iterator& operator--() {
+            --pos;
+            return *this;
+        }
+        basic_iterator operator++(int) {
+            basic_iterator it = *this;
+            ++pos;
+            return it;
+        }
+        basic_iterator operator--(int) {
+            basic_iterator it = *this;
+            --pos;
+            return it;
+        }
+
+        bool operator==(const basic_iterator& rhs) const { return buf == rhs.buf && pos == rhs.pos; }
+        bool operator!=(const basic_iterator& rhs) const { return !(*this == rhs); }
+        bool operator<(const basic_iterator& rhs) const { return pos < rhs.pos; }
+        bool operator<=(const basic_iterator& rhs) const { return pos <= rhs.pos; }
+        bool operator>(const basic_iterator& rhs) const { return pos > rhs.pos; }
+        bool operator>=(const basic_iterator& rhs) const { return pos >= rhs.pos; }
+    };
+
+    T* buf_;
+    container::detail::index_ref head_;
+    container::detail::index_ref size_;
+    size_t capacity_;
+
+public:
+    using value_type = T;
+    using iterator = basic_iterator<T>;
+    using const_iterator = basic_iterator<const T>;
+
+    template <typename Index>
+    deque_ref(T* buf, Index& head, Index& size, const size_t capacity, container::detail::drop_counter<Overflow::counts_drops>& c)
+    : counter(c), buf_(buf), head_(head), size_(size), capacity_(capacity) {}
+
+    // number of elements lost by overflow (always 0 if the policy doesn't count)
+    using counter::dropped;
+    using counter::reset_dropped;
+
+    size_t capacity() const { return capacity_; }
+    size_t size() const { return size_.get(); }
+    bool empty() const { return size() == 0; }
+
+    void clear() {
+        for (size_t i = 0; i < size(); ++i)
+            storage::destroy(ptr(i));
+        head_.set(0);
+        size_.set(0);
+    }
+
+    void pop_front() {
+        const size_t n = size();
+        if (n == 0) return;
+        storage::destroy(ptr(0));
+        head_.set(wrap(head() + 1));
+        size_.set(n - 1);
+    }
+    void pop_back() {
+        const size_t n = size();
+        if (n == 0) return;
+        storage::destroy(ptr(n - 1));
+        size_.set(n - 1);
+    }
+
+    container::push_result push_back(const T& data) {
+        return store_back(data);
+    }
+    container::push_result push_back(T&& data) {
+        return store_back(container::detail::move(data));
+    }
+    container::push_result push_front(const T& data) {
+        return store_front(data);
+    }
+    container::push_result push_front(T&& data) {
+        return store_front(container::detail::move(data));
+    }
+    template <class... Args>
+    container::push_result emplace_back(Args&&... args) {
+        const size_t n = size();
+        if (n == capacity_) {
+            if (Overflow::rejects_new) return reject();
+            // the slot to be reused is the oldest element, which args may refer to
+            return push_back(T(container::detail::forward<Args>(args)...));
+        }
+        storage::emplace(ptr(n), container::detail::forward<Args>(args)...);
+        size_.set(n + 1);
+        return container::push_result::ok;
+    }
+    template <class... Args>
+    container::push_result emplace_front(Args&&... args) {
+        const size_t n = size();
+        if (n == capacity_) {
+            if (Overflow::rejects_new) return reject();
+            // the slot to be reused is the newest element, which args may refer to
+            return push_front(T(container::detail::forward<Args>(args)...));
+        }
+        head_.set(prev(head()));
+        size_.set(n + 1);
+        storage::emplace(ptr(0), container::detail::forward<Args>(args)...);
+        return container::push_result::ok;
+    }
+
+    const T& front() const { return get(0); }
+    T& front() { return get(0); }
+
+    const T& back() const { return get(size() - 1); }
+    T& back() { return get(size() - 1); }
+
+    const T& operator[](size_t index) const { return get(index); }
+    T& operator[](size_t index) { return get(index); }
+
+    iterator begin() { return empty() ? iterator() : iterator(buf_, capacity_, static_cast<int>(head())); }
+    iterator end() { return empty() ? iterator() : iterator(buf_, capacity_, static_cast<int>(head() + size())); }
+    const_iterator begin() const { return empty() ? const_iterator() : const_iterator(buf_, capacity_, static_cast<int>(head())); }
+    const_iterator end() const { return empty() ? const_iterator() : const_iterator(buf_, capacity_, static_cast<int>(head() + size())); }
+
+    // https://en.cppreference.com/w/cpp/container/deque/erase
+    // the elements before or after the erased range are shifted, whichever are fewer
+    iterator erase(const const_iterator& p) {
+        if (!is_valid(p)) return end();
+        return erase(p, p + 1);
+    }
+
+    iterator erase(const const_iterator& first, const const_iterator& last) {
+        if (!is_valid(first) || last < first || (last != end() && !is_valid(last))) return end();
+
+        const size_t index = first - begin();
+        erase_n(index, last - first);
+        return empty() ? end() : iterator(buf_, capacity_, static_cast<int>(head() + index));
+    }
+
+    // erase all the elements which satisfy pred, and return the number of erased elements
+    // the remaining elements are compacted in one pass (runs of them are moved at once)
+    template <class Pred>
+    size_t erase_if(Pred pred) {
+        const size_t n = size();
+        const live_slots live {0, n};
+        size_t kept = 0;
+        for (size_t i = 0; i < n;) {
+            if (pred(get(i))) {
+                ++i;
+                continue;
+            }
+            size_t j = i + 1;
+            while (j < n && !pred(get(j))) ++j;
+            move_range(kept, i, j - i, live);
+            kept += j - i;
+            // get(j) has already matched (pred is called once per element)
+            i = j + 1;
+        }
+        for (size_t i = kept; i < n; ++i) storage::destroy(ptr(i));
+        size_.set(kept);
+        return n - kept;
+    }
+
+    void resize(size_t sz) {
+        if (Overflow::rejects_new && sz > capacity_) sz = capacity_;
+        const size_t s = size();
+        if (sz > s) {
+            for (size_t i = 0; i < sz - s; ++i) emplace_back();
+        } else if (sz < s) {
+            for (size_t i = 0; i < s - sz; ++i) pop_back();
+        }
+    }
+
+    void fill(const T& v) {
+        for (size_t i = 0; i < size(); ++i) get(i) = v;
+    }
+
+    // https://en.cppreference.com/w/cpp/container/vector/insert
+    // if the result exceeds the capacity, elements after the inserted range are dropped,
+    // or, if the inserted range itself does not fit, the front elements are overwritten.
+    // if the policy rejects new elements, nothing is inserted unless all of them fit.
+    template <typename It>
+    void insert(const const_iterator& pos, It first, It last) {
+        if (!is_valid(pos) && pos != end())
+            return;
+
+        insert_n(pos - begin(), first, last - first);
+    }
+
+    // val may refer to an element to be shifted, so it is copied first
+    void insert(const const_iterator& pos, const T& val) {
+        insert(pos, T(val));
+    }
+
+    void insert(const const_iterator& pos, T&& val) {
+        if (!is_valid(pos) && pos != end())
+            return;
+
+        insert_one(pos - begin(), container::detail::move(val));
+    }
+
+    // push n elements to the back, and return the number of elements stored.
+    // if there is no space, the oldest ones are overwritten, or the rest of src is rejected
+    // trivially copyable elements are copied by at most two memcpy
+    size_t push_back(const T* src, size_t n) {
+        if (Overflow::rejects_new && size() + n > capacity_) {
+            reject(size() + n - capacity_);
+            n = capacity_ - size();
+        }
+        if (!container::detail::is_trivially_copyable<T>::value) {
+            for (size_t i = 0; i < n; ++i) push_back(src[i]);
+            return n;
+        }
+        const size_t pushed = n;
+        if (size() + n > capacity_)
+            counter::count_drop(size() + n - capacity_);
+        if (n >= capacity_) {
+            // only the last capacity() elements survive
+            src += n - capacity_;
+            n = capacity_;
+            head_.set(0);
+            size_.set(0);
+        } else if (size() + n > capacity_) {
+            const size_t drop = size() + n - capacity_;
+            head_.set(wrap(head() + drop));
+            size_.set(size() - drop);
+        }
+        copy_in(size(), src, n);
+        size_.set(size() + n);
+        return pushed;
+    }
+
+    // move up to n elements from the front to dst, and return the number of elements popped
+    size_t pop_front(T* dst, size_t n) {
+        if (n > size()) n = size();
+        if (!container::detail::is_trivially_copyable<T>::value) {
+            for (size_t i = 0; i < n; ++i) {
+                dst[i] = container::detail::move(front());
+                pop_front();
+            }
+            return n;
+        }
+        copy_out(dst, 0, n);
+        head_.set(wrap(head() + n));
+        size_.set(size() - n);
+        return n;
+    }
+
+    // copy up to n elements from offset to dst without removing them,
+    // and return the number of elements copied
+    size_t peek(T* dst, size_t n, size_t offset = 0) const {
+        if (offset >= size()) return 0;
+        if (n > size() - offset) n = size() - offset;
+        copy_out(dst, offset, n);
+        return n;
+    }
+
+    // the stored elements as (at most) two contiguous blocks
+    container::segments<T> linear_segments() {
+        const size_t first = contiguous_size();
+        return {{buf_ + head(), first}, {buf_, size() - first}};
+    }
+    container::segments<const T> linear_segments() const {
+        const size_t first = contiguous_size();
+        return {{buf_ + head(), first}, {buf_, size() - first}};
+    }
+
+private:
+    size_t head() const { return head_.get(); }
+
+    // positions are in [0, 2 * capacity)
+    size_t wrap(const size_t pos) const { return (pos >= capacity_) ? pos - capacity_ : pos; }
+    size_t prev(const size_t pos) const { return (pos == 0) ? capacity_ - 1 : pos - 1; }
+
+    // position of the logical index in the storage
+    size_t slot(const size_t index) const { return wrap(head() + index); }
+
+    T& get(const size_t index) { return buf_[slot(index)]; }
+    const T& get(const size_t index) const { return buf_[slot(index)]; }
+    T* ptr(const size_t index) { return buf_ + slot(index); }
+
+    // number of elements from head before the storage wraps around
+    size_t contiguous_size() const {
+        const size_t to_end = capacity_ - head();
+        return size() < to_end ? size() : to_end;
+    }
+
+    // copy n elements from the logical index, in at most two blocks
+    void copy_out(T* dst, const size_t index, const size_t n) const {
+        if (!container::detail::is_trivially_copyable<T>::value) {
+            for (size_t i = 0; i < n; ++i) dst[i] = get(index + i);
+            return;
+        }
+        if (n == 0) return;
+        const size_t pos = slot(index);
+        const size_t first = n < capacity_ - pos ? n : capacity_ - pos;
+        memcpy(static_cast<void*>(dst), static_cast<const void*>(buf_ + pos), first * sizeof(T));
+        memcpy(static_cast<void*>(dst + first), static_cast<const void*>(buf_), (n - first) * sizeof(T));
+    }
+
+    // copy n trivially copyable elements to the free slots from the logical index
+    void copy_in(const size_t index, const T* src, const size_t n) {
+        if (n == 0) return;
+        const size_t pos = slot(index);
+        const size_t first = n < capacity_ - pos ? n : capacity_ - pos;
+        memcpy(static_cast<void*>(buf_ + pos), static_cast<const void*>(src), first * sizeof(T));
+        memcpy(static_cast<void*>(buf_), static_cast<const void*>(src + first), (n - first) * sizeof(T));
+    }
+
+    container::push_result reject(const size_t n = 1) {
+        counter::count_drop(n);
+        return container::push_result::rejected;
+    }
+
+    // if full, the oldest element's slot is reused (it is still constructed)
+    template <class U>
+    container::push_result store_back(U&& data) {
+        const size_t n = size();
+        if (n == capacity_) {
+            if (Overflow::rejects_new) return reject();
+            counter::count_drop();
+            get(0) = container::detail::forward<U>(data);
+            head_.set(wrap(head() + 1));
+            return container::push_result::overwritten;
+        }
+        storage::put(ptr(n), container::detail::forward<U>(data));
+        size_.set(n + 1);
+        return container::push_result::ok;
+    }
+    // if full, the newest element's slot is reused (it is still constructed)
+    template <class U>
+    container::push_result store_front(U&& data) {
+        const size_t n = size();
+        if (n == capacity_) {
+            if (Overflow::rejects_new) return reject();
+            counter::count_drop();
+            head_.set(prev(head()));
+            get(0) = container::detail::forward<U>(data);
+            return container::push_result::overwritten;
+        }
+        head_.set(prev(head()));
+        size_.set(n + 1);
+        storage::put(ptr(0), container::detail::forward<U>(data));
+        return container::push_result::ok;
+    }
+
+    // logical indices of the slots which hold an element, others are free
+    struct live_slots {
+        size_t first;
+        size_t last;
+        bool has(const size_t i) const { return first <= i && i < last; }
+    };
+
+    template <class U>
+    void store_at(const size_t index, const live_slots& live, U&& data) {
+        if (live.has(index))
+            get(index) = container::detail::forward<U>(data);
+        else
+            storage::put(ptr(index), container::detail::forward<U>(data));
+    }
+
+    // erase n elements from index (index + n <= size)
+    void erase_n(const size_t index, const size_t n) {
+        const size_t back = size() - index - n;
+        const live_slots live {0, size()};
+        if (index < back) {
+            move_range(n, 0, index, live);
+            for (size_t i = 0; i < n; ++i) storage::destroy(ptr(i));
+            head_.set(wrap(head() + n));
+        } else {
+            move_range(index, index + n, back, live);
+            for (size_t i = size() - n; i < size(); ++i) storage::destroy(ptr(i));
+        }
+        size_.set(size() - n);
+    }
+
+    // insert val at index (index <= size)
+    void insert_one(const size_t index, T&& val) {
+        if (index == capacity_) {
+            push_back(container::detail::move(val));
+            return;
+        }
+        if (Overflow::rejects_new && size() == capacity_) {
+            reject();
+            return;
+        }
+        const live_slots live = open_gap(index, 1);
+        store_at(index, live, container::detail::move(val));
+    }
+
+    // insert sz elements from first at index (index <= size)
+    template <typename It>
+    void insert_n(const size_t index, It first, const size_t sz) {
+        if (Overflow::rejects_new && size() + sz > capacity_) {
+            reject(sz);
+            return;
+        }
+        if (index + sz > capacity_) {
+            // the inserted range itself overflows: drop everything after index,
+            // then push the range back, which overwrites the front elements
+            counter::count_drop(size() - index);
+            while (size() > index) pop_back();
+            for (size_t i = 0; i < sz; ++i) push_back(*(first + i));
+            return;
+        }
+        const live_slots live = open_gap(index, sz);
+        for (size_t i = 0; i < sz; ++i)
+            store_at(index + i, live, *(first + i));
+    }
+
+    // make room for sz elements at index (index + sz <= capacity) by shifting the elements before or after it,
+    // whichever are fewer, and return the slots which held an element before the gap was opened.
+    // size is already advanced when returned, and the gap must be filled with store_at().
+    live_slots open_gap(const size_t index, const size_t sz) {
+        // elements pushed out of the capacity are dropped
+        if (size() + sz > capacity_) counter::count_drop(size() + sz - capacity_);
+        while (size() + sz > capacity_) pop_back();
+        const size_t n = size();
+        if (index < n - index) {
+            head_.set(wrap(head() + capacity_ - sz));
+            size_.set(n + sz);
+            const live_slots live {sz, n + sz};
+            move_range(0, sz, index, live);
+            return live;
+        }
+        const live_slots live {0, n};
+        move_range(index + sz, index, n - index, live);
+        size_.set(n + sz);
+        return live;
+    }
+
+    // move n elements from the logical index src to dst (the ranges may overlap)
+    // trivially copyable elements are moved by memmove, in blocks which don't wrap around
+    void move_range(const size_t dst, const size_t src, size_t n, const live_slots& live) {
+        if (n == 0 || dst == src) return;
+        if (!container::detail::is_trivially_copyable<T>::value) {
+            if (dst < src) {
+                for (size_t i = 0; i < n; ++i)
+                    store_at(dst + i, live, container::detail::move(get(src + i)));
+            } else {
+                for (size_t i = n; i-- > 0;)
+                    store_at(dst + i, live, container::detail::move(get(src + i)));
+            }
+            return;
+        }
+        if (dst < src) {
+            // from the front
+            for (size_t done = 0; done < n;) {
+                const size_t d = slot(dst + done);
+                const size_t s = slot(src + done);
+                size_t len = n - done;
+                if (len > capacity_ - d) len = capacity_ - d;
+                if (len > capacity_ - s) len = capacity_ - s;
+                memmove(static_cast<void*>(buf_ + d), static_cast<const void*>(buf_ + s), len * sizeof(T));
+                done += len;
+            }
+        } else {
+            // from the back (d and s are the ends of the blocks)
+            while (n > 0) {
+                const size_t d = slot(dst + n - 1) + 1;
+                const size_t s = slot(src + n - 1) + 1;
+                size_t len = n;
+                if (len > d) len = d;
+                if (len > s) len = s;
+                memmove(static_cast<void*>(buf_ + d - len), static_cast<const void*>(buf_ + s - len), len * sizeof(T));
+                n -= len;
+            }
+        }
+    }
+
+    bool is_valid(const const_iterator& it) const {
+        if (it.buf != buf_)
+            return false;  // iterator to a different object
+        const size_t pos = static_cast<size_t>(it.pos);
+        return (it.pos >= 0) && (pos >= head()) && (pos < head() + size());
+    }
+};
+
+}  // namespace stdx
+}  // namespace arx
+
+#endif  // ARX_CONTAINER_CONTAINER_REF_H
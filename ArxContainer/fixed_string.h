@@ -0,0 +1,261 @@
+#pragma once
+
+#ifndef ARX_CONTAINER_FIXED_STRING_H
+#define ARX_CONTAINER_FIXED_STRING_H
+
+// included from ArxContainer.h
+
+namespace arx {
+
+namespace container {
+    namespace detail {
+        // hash of a fixed_string, kept up to date on every modification if Cache is true
+        // the state before hash_mix is kept, so appended characters only extend it
+        template <bool Cache>
+        struct string_hash_cache {
+            size_t state_ {string_hash_seed};
+
+            void rehash(const char* s, const size_t len) { state_ = string_hash_extend(string_hash_seed, s, len); }
+            void extend(const char* s, const size_t len) { state_ = string_hash_extend(state_, s, len); }
+            size_t hash(const char*, const size_t) const { return hash_mix(state_); }
+        };
+
+        template <>
+        struct string_hash_cache<false> {
+            void rehash(const char*, const size_t) {}
+            void extend(const char*, const size_t) {}
+            size_t hash(const char* s, const size_t len) const { return string_hash(s, len); }
+        };
+    }  // namespace detail
+}  // namespace container
+
+namespace stdx {
+
+// string of up to N characters stored inline (no heap), always null-terminated, with its length.
+// == compares the lengths (and the cached hashes) first, and ordering is memcmp, as string_view.
+// longer strings are truncated to N characters.
+// characters are modified only through member functions, so that the length and the hash stay valid.
+// if CacheHash is true, the hash for unordered containers is computed on modification instead of on lookup.
+template <size_t N, bool CacheHash = false>
+class fixed_string : container::detail::string_hash_cache<CacheHash> {
+    using cache = container::detail::string_hash_cache<CacheHash>;
+    using length_type = typename container::detail::least_uint<N>::type;
+
+    char buf_[N + 1];
+    length_type len_;
+
+public:
+    using value_type = char;
+    using const_iterator = const char*;
+    using iterator = const char*;
+
+    static constexpr size_t npos = static_cast<size_t>(-1);
+
+    fixed_string()
+    : len_(0) {
+        update();
+    }
+    fixed_string(const char* s)
+    : len_(0) {
+        assign(s ? s : "", s ? strlen(s) : 0);
+    }
+    fixed_string(const char* s, const size_t len)
+    : len_(0) {
+        assign(s, len);
+    }
+    fixed_string(const string_view& s)
+    : len_(0) {
+        assign(s.data(), s.size());
+    }
+#ifdef ARDUINO
+    fixed_string(const String& s)
+    : len_(0) {
+        assign(s.c_str(), s.length());
+    }
+#endif
+    template <size_t M, bool C>
+    explicit fixed_string(const fixed_string<M, C>& s)
+    : len_(0) {
+        assign(s.data(), s.size());
+    }
+
+    // only the characters in use are copied
+    fixed_string(const fixed_string& r)
+    : cache(r), len_(r.len_) {
+        memcpy(buf_, r.buf_, len_ + 1u);
+    }
+    fixed_string& operator=(const fixed_string& r) {
+        if (this != &r) {
+            cache::operator=(r);
+            len_ = r.len_;
+            memcpy(buf_, r.buf_, len_ + 1u);
+        }
+        return *this;
+    }
+
+    size_t size() const { return len_; }
+    size_t length() const { return len_; }
+    size_t capacity() const { return N; }
+    size_t max_size() const { return N; }
+    bool empty() const { return len_ == 0; }
+    bool full() const { return len_ == N; }
+
+    const char* c_str() const { return buf_; }
+    const char* data() const { return buf_; }
+    const char& operator[](const size_t i) const { return buf_[i]; }
+    const char& front() const { return buf_[0]; }
+    const char& back() const { return buf_[len_ - 1]; }
+
+    const_iterator begin() const { return buf_; }
+    const_iterator end() const { return buf_ + len_; }
+
+    operator string_view() const { return string_view(buf_, len_); }
+
+    // hash for unordered containers (cached if CacheHash is true)
+    size_t hash() const { return cache::hash(buf_, len_); }
+
+    void clear() {
+        len_ = 0;
+        update();
+    }
+
+    fixed_string& assign(const char* s, size_t len) {
+        if (len > N) len = N;
+        memmove(buf_, s, len);
+        len_ = static_cast<length_type>(len);
+        update();
+        return *this;
+    }
+    fixed_string& assign(const string_view& s) {
+        return assign(s.data(), s.size());
+    }
+
+    // the characters which don't fit are dropped
+    fixed_string& append(const char* s, size_t len) {
+        if (len > N - len_) len = N - len_;
+        memmove(buf_ + len_, s, len);
+        const size_t from = len_;
+        len_ = static_cast<length_type>(len_ + len);
+        update(from);
+        return *this;
+    }
+    fixed_string& append(const string_view& s) {
+        return append(s.data(), s.size());
+    }
+
+    fixed_string& operator+=(const string_view& s) { return append(s); }
+    fixed_string& operator+=(const char c) {
+        push_back(c);
+        return *this;
+    }
+
+    void push_back(const char c) {
+        if (full()) return;
+        buf_[len_++] = c;
+        update(len_ - 1u);
+    }
+    void pop_back() {
+        if (empty()) return;
+        --len_;
+        update();
+    }
+
+    // new characters are c
+    void resize(size_t len, const char c = '\0') {
+        if (len > N) len = N;
+        if (len > len_) {
+            memset(buf_ + len_, c, len - len_);
+            const size_t from = len_;
+            len_ = static_cast<length_type>(len);
+            update(from);
+        } else {
+            len_ = static_cast<length_type>(len);
+            update();
+        }
+    }
+
+    int compare(const string_view& s) const { return string_view(*this).compare(s); }
+    bool starts_with(const string_view& s) const { return string_view(*this).starts_with(s); }
+    bool ends_with(const string_view& s) const { return string_view(*this).ends_with(s); }
+    size_t find(const char c, const size_t pos = 0) const { return string_view(*this).find(c, pos); }
+    size_t find(const string_view& s, const size_t pos = 0) const { return string_view(*this).find(s, pos); }
+    string_view substr(const size_t pos, const size_t count = npos) const { return string_view(*this).substr(pos, count); }
+
+    // comparison with string_view, const char* and String (fixed_string of any N is below)
+    friend bool operator==(const fixed_string& x, const string_view& y) { return string_view(x) == y; }
+    friend bool operator==(const string_view& x, const fixed_string& y) { return x == string_view(y); }
+    friend bool operator!=(const fixed_string& x, const string_view& y) { return string_view(x) != y; }
+    friend bool operator!=(const string_view& x, const fixed_string& y) { return x != string_view(y); }
+    friend bool operator<(const fixed_string& x, const string_view& y) { return string_view(x) < y; }
+    friend bool operator<(const string_view& x, const fixed_string& y) { return x < string_view(y); }
+    friend bool operator>(const fixed_string& x, const string_view& y) { return string_view(x) > y; }
+    friend bool operator>(const string_view& x, const fixed_string& y) { return x > string_view(y); }
+    friend bool operator<=(const fixed_string& x, const string_view& y) { return string_view(x) <= y; }
+    friend bool operator<=(const string_view& x, const fixed_string& y) { return x <= string_view(y); }
+    friend bool operator>=(const fixed_string& x, const string_view& y) { return string_view(x) >= y; }
+    friend bool operator>=(const string_view& x, const fixed_string& y) { return x >= string_view(y); }
+
+private:
+    void update() {
+        buf_[len_] = '\0';
+        this->rehash(buf_, len_);
+    }
+    // only [from, len_) has changed (appended), so the cached hash is extended instead of recomputed
+    void update(const size_t from) {
+        buf_[len_] = '\0';
+        this->extend(buf_ + from, len_ - from);
+    }
+};
+
+template <size_t N, bool C>
+constexpr size_t fixed_string<N, C>::npos;
+
+template <size_t N, bool C, size_t M, bool D>
+inline bool operator==(const fixed_string<N, C>& x, const fixed_string<M, D>& y) {
+    if (x.size() != y.size()) return false;
+    if (C && D && x.hash() != y.hash()) return false;
+    return memcmp(x.data(), y.data(), x.size()) == 0;
+}
+template <size_t N, bool C, size_t M, bool D>
+inline bool operator!=(const fixed_string<N, C>& x, const fixed_string<M, D>& y) {
+    return !(x == y);
+}
+template <size_t N, bool C, size_t M, bool D>
+inline bool operator<(const fixed_string<N, C>& x, const fixed_string<M, D>& y) {
+    return x.compare(y) < 0;
+}
+template <size_t N, bool C, size_t M, bool D>
+inline bool operator>(const fixed_string<N, C>& x, const fixed_string<M, D>& y) {
+    return x.compare(y) > 0;
+}
+template <size_t N, bool C, size_t M, bool D>
+inline bool operator<=(const fixed_string<N, C>& x, const fixed_string<M, D>& y) {
+    return x.compare(y) <= 0;
+}
+template <size_t N, bool C, size_t M, bool D>
+inline bool operator>=(const fixed_string<N, C>& x, const fixed_string<M, D>& y) {
+    return x.compare(y) >= 0;
+}
+
+}  // namespace stdx
+
+namespace container {
+    template <size_t N, bool C>
+    struct hash<stdx::fixed_string<N, C>> {
+        size_t operator()(const stdx::fixed_string<N, C>& s) const { return s.hash(); }
+    };
+}  // namespace container
+
+}  // namespace arx
+
+#if ARX_HAVE_LIBSTDCPLUSPLUS >= 201103L  // Have libstdc++11
+// for std::unordered_map
+namespace std {
+template <size_t N, bool C>
+struct hash<arx::stdx::fixed_string<N, C>> {
+    size_t operator()(const arx::stdx::fixed_string<N, C>& s) const { return s.hash(); }
+};
+}  // namespace std
+#endif
+
+#endif  // ARX_CONTAINER_FIXED_STRING_H
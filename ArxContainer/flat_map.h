@@ -0,0 +1,146 @@
+#pragma once
+
+#ifndef ARX_CONTAINER_FLAT_MAP_H
+#define ARX_CONTAINER_FLAT_MAP_H
+
+// included from ArxContainer.h
+
+namespace arx {
+namespace stdx {
+
+// map which keeps its elements sorted by key in a contiguous array (see sorted_table).
+// lookups are binary searches (O(log N) comparisons) and iteration is ordered like std::map.
+// insert/erase shift the following elements (memmove for trivially copyable ones).
+// if it's full, a new key is not inserted (insert() returns {end(), false}).
+// Compare must be default constructible, and is constructed on each comparison (no SRAM is used for it).
+// iterators point to pair<Key, T>: don't assign to it->first, which breaks the order that lookups rely on.
+template <class Key, class T, size_t N = ARX_MAP_DEFAULT_SIZE,
+          class Compare = less<Key>,
+          typename Storage = container::initialized_storage>
+struct flat_map : public container::detail::sorted_table<pair<Key, T>, Key, Compare, N, Storage, pair<Key, T>*> {
+    using base = container::detail::sorted_table<pair<Key, T>, Key, Compare, N, Storage, pair<Key, T>*>;
+    using mapped_type = T;
+    using value_type = pair<Key, T>;
+    using iterator = typename base::iterator;
+    using const_iterator = typename base::const_iterator;
+
+    flat_map()
+    : base() {}
+    flat_map(std::initializer_list<value_type> lst)
+    : base() {
+        for (auto it = lst.begin(); it != lst.end(); ++it)
+            insert(*it);
+    }
+
+    // copy
+    flat_map(const flat_map& r)
+    : base(r) {}
+
+    flat_map& operator=(const flat_map& r) {
+        base::operator=(r);
+        return *this;
+    }
+
+    // move
+    flat_map(flat_map&& r)
+    : base(container::detail::move(r)) {}
+
+    flat_map& operator=(flat_map&& r) {
+        base::operator=(container::detail::move(r));
+        return *this;
+    }
+
+    // t may refer to an element, so it is copied before the others are shifted
+    pair<iterator, bool> insert(const Key& key, const T& t) {
+        return try_emplace(key, T(t));
+    }
+
+    pair<iterator, bool> insert(const value_type& p) {
+        return try_emplace(p.first, T(p.second));
+    }
+
+    pair<iterator, bool> insert(value_type&& p) {
+        return try_emplace(container::detail::move(p.first), container::detail::move(p.second));
+    }
+
+    pair<iterator, bool> emplace(const Key& key, const T& t) {
+        return insert(key, t);
+    }
+
+    pair<iterator, bool> emplace(const value_type& p) {
+        return insert(p);
+    }
+
+    pair<iterator, bool> emplace(value_type&& p) {
+        return insert(container::detail::move(p));
+    }
+
+    // construct the mapped value in its slot only if the key does not exist
+    // if the map is full, {end(), false} is returned
+    // args must not refer to the elements, because they are shifted before the value is constructed
+    template <class... Args>
+    pair<iterator, bool> try_emplace(const Key& key, Args&&... args) {
+        iterator it = this->lower_bound(key);
+        if (this->is_key_at(it, key)) return {it, false};
+        return emplace_new(it, key, container::detail::forward<Args>(args)...);
+    }
+
+    template <class... Args>
+    pair<iterator, bool> try_emplace(Key&& key, Args&&... args) {
+        iterator it = this->lower_bound(key);
+        if (this->is_key_at(it, key)) return {it, false};
+        return emplace_new(it, container::detail::move(key), container::detail::forward<Args>(args)...);
+    }
+
+    // assign to the mapped value if the key exists, otherwise insert it (with a single lookup)
+    template <class M>
+    pair<iterator, bool> insert_or_assign(const Key& key, M&& obj) {
+        iterator it = this->lower_bound(key);
+        if (this->is_key_at(it, key)) {
+            it->second = container::detail::forward<M>(obj);
+            return {it, false};
+        }
+        // obj may refer to an element, so it is copied before the others are shifted
+        return emplace_new(it, key, T(container::detail::forward<M>(obj)));
+    }
+
+private:
+    T& empty_value() const {
+        static T val;
+        val = T(); // fresh empty value every time
+        return val;
+    }
+
+public:
+    const T& at(const Key& key) const {
+        const_iterator it = this->find(key);
+        if (it != this->end()) return it->second;
+        return empty_value();
+    }
+
+    T& at(const Key& key) {
+        iterator it = this->find(key);
+        if (it != this->end()) return it->second;
+        return empty_value();
+    }
+
+    // if the key can't be added because the map is full, a fresh empty value is returned
+    T& operator[](const Key& key) {
+        iterator it = try_emplace(key).first;
+        if (it == this->end()) return empty_value();
+        return it->second;
+    }
+
+private:
+    // a key which is not found is not one of the elements, so it can be passed to emplace_at as is
+    template <class K, class... Args>
+    pair<iterator, bool> emplace_new(const_iterator pos, K&& key, Args&&... args) {
+        iterator it = this->emplace_at(pos, container::detail::in_place_key_t(), container::detail::forward<K>(key), container::detail::forward<Args>(args)...);
+        return {it, it != this->end()};
+    }
+};
+
+}  // namespace stdx
+}  // namespace arx
+
+#endif  // ARX_CONTAINER_FLAT_MAP_H
@@ -0,0 +1,28 @@
+#pragma once
+
+#ifndef ARX_CONTAINER_FUNCTIONAL_H
+#define ARX_CONTAINER_FUNCTIONAL_H
+
+// comparators used by the ordered containers
+// if <functional> is available, std::less etc. are used through arx::stdx as they are
+#if ARX_HAVE_LIBSTDCPLUSPLUS >= 201103L  // Have libstdc++11
+#include <functional>
+#else
+namespace arx {
+namespace stdx {
+
+    template <class T>
+    struct less {
+        constexpr bool operator()(const T& x, const T& y) const { return x < y; }
+    };
+
+    template <class T>
+    struct greater {
+        constexpr bool operator()(const T& x, const T& y) const { return x > y; }
+    };
+
+}  // namespace stdx
+}  // namespace arx
+#endif
+
+#endif  // ARX_CONTAINER_FUNCTIONAL_H
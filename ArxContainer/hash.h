@@ -0,0 +1,131 @@
+#pragma once
+
+#ifndef ARX_CONTAINER_HASH_H
+#define ARX_CONTAINER_HASH_H
+
+// included from ArxContainer.h
+
+namespace arx {
+namespace container {
+
+    namespace detail {
+        // odd multiplier (golden ratio) as wide as size_t
+        template <size_t Bytes>
+        struct golden_ratio;
+        template <>
+        struct golden_ratio<2> { static constexpr size_t value = 0x9E37u; };
+        template <>
+        struct golden_ratio<4> { static constexpr size_t value = static_cast<size_t>(0x9E3779B9ul); };
+        template <>
+        struct golden_ratio<8> { static constexpr size_t value = static_cast<size_t>(0x9E3779B97F4A7C15ull); };
+
+        // multiplicative hashing, and fold the well-mixed high half into the low bits
+        // because hash tables take the index from the low bits
+        inline size_t hash_mix(size_t h) {
+            h *= golden_ratio<sizeof(size_t)>::value;
+            return h ^ (h >> (sizeof(size_t) * 4));
+        }
+
+        // integers wider than size_t are folded first (e.g. uint32_t on AVR)
+        template <class T, bool = (sizeof(T) > sizeof(size_t))>
+        struct integer_hash {
+            size_t operator()(const T v) const {
+                return hash_mix(static_cast<size_t>(v));
+            }
+        };
+        template <class T>
+        struct integer_hash<T, true> {
+            size_t operator()(const T v) const {
+                const unsigned long long u = static_cast<unsigned long long>(v);
+                size_t h = 0;
+                for (size_t i = 0; i < sizeof(T); i += sizeof(size_t))
+                    h ^= static_cast<size_t>(u >> (i * 8));
+                return hash_mix(h);
+            }
+        };
+
+        // djb2 (xor variant): only shifts and adds per character, which is cheap on AVR
+        // the state before hash_mix can be extended by more characters (see string_hash_cache)
+        constexpr size_t string_hash_seed = 5381;
+        inline size_t string_hash_extend(size_t h, const char* s, size_t len) {
+            for (size_t i = 0; i < len; ++i)
+                h = ((h << 5) + h) ^ static_cast<unsigned char>(s[i]);
+            return h;
+        }
+        inline size_t string_hash(const char* s, size_t len) {
+            return hash_mix(string_hash_extend(string_hash_seed, s, len));
+        }
+        inline size_t string_hash(const char* s) {
+            size_t h = string_hash_seed;
+            if (s)
+                while (*s) h = ((h << 5) + h) ^ static_cast<unsigned char>(*s++);
+            return hash_mix(h);
+        }
+    }  // namespace detail
+
+    // hash functors for unordered containers
+    // if libstdc++ is available, other types are hashed by std::hash
+#if ARX_HAVE_LIBSTDCPLUSPLUS >= 201103L  // Have libstdc++11
+    template <class T>
+    struct hash : std::hash<T> {};
+#else
+    template <class T>
+    struct hash;
+#endif
+
+    template <> struct hash<bool> : detail::integer_hash<bool> {};
+    template <> struct hash<char> : detail::integer_hash<char> {};
+    template <> struct hash<signed char> : detail::integer_hash<signed char> {};
+    template <> struct hash<unsigned char> : detail::integer_hash<unsigned char> {};
+    template <> struct hash<wchar_t> : detail::integer_hash<wchar_t> {};
+    template <> struct hash<char16_t> : detail::integer_hash<char16_t> {};
+    template <> struct hash<char32_t> : detail::integer_hash<char32_t> {};
+    template <> struct hash<short> : detail::integer_hash<short> {};
+    template <> struct hash<unsigned short> : detail::integer_hash<unsigned short> {};
+    template <> struct hash<int> : detail::integer_hash<int> {};
+    template <> struct hash<unsigned int> : detail::integer_hash<unsigned int> {};
+    template <> struct hash<long> : detail::integer_hash<long> {};
+    template <> struct hash<unsigned long> : detail::integer_hash<unsigned long> {};
+    template <> struct hash<long long> : detail::integer_hash<long long> {};
+    template <> struct hash<unsigned long long> : detail::integer_hash<unsigned long long> {};
+
+    // C strings are hashed by their contents (not by the pointer as std::hash does)
+    template <>
+    struct hash<const char*> {
+        size_t operator()(const char* s) const { return detail::string_hash(s); }
+    };
+    template <>
+    struct hash<char*> {
+        size_t operator()(const char* s) const { return detail::string_hash(s); }
+    };
+
+    template <>
+    struct hash<stdx::string_view> {
+        size_t operator()(const stdx::string_view& s) const { return detail::string_hash(s.data(), s.size()); }
+    };
+
+#ifdef ARDUINO
+    template <>
+    struct hash<String> {
+        size_t operator()(const String& s) const { return detail::string_hash(s.c_str(), s.length()); }
+    };
+#endif
+
+    // C strings are compared by their contents
+    template <class T>
+    struct key_equal {
+        bool operator()(const T& x, const T& y) const { return x == y; }
+    };
+    template <>
+    struct key_equal<const char*> {
+        bool operator()(const char* x, const char* y) const { return strcmp(x, y) == 0; }
+    };
+    template <>
+    struct key_equal<char*> {
+        bool operator()(const char* x, const char* y) const { return strcmp(x, y) == 0; }
+    };
+
+}  // namespace container
+}  // namespace arx
+
+#endif  // ARX_CONTAINER_HASH_H
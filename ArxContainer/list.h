@@ -0,0 +1,358 @@
+#pragma once
+
+#ifndef ARX_CONTAINER_LIST_H
+#define ARX_CONTAINER_LIST_H
+
+// included from ArxContainer.h
+
+namespace arx {
+
+namespace container {
+    namespace detail {
+        // pool of N nodes linked by indices (least_uint<N>, so 1 byte per link if N < 256).
+        // index N is the sentinel: next_[N] is the first element and prev_[N] is the last one.
+        // free nodes are chained through next_ from free_.
+        template <typename T, size_t N, typename Storage>
+        struct node_storage;
+
+        template <typename T, size_t N>
+        struct node_links {
+            using index_type = typename least_uint<N>::type;
+            static constexpr index_type nil = static_cast<index_type>(N);
+
+            index_type next_[N + 1];
+            index_type prev_[N + 1];
+            index_type free_;
+            index_type size_;
+
+            node_links() { reset(); }
+
+            void reset() {
+                for (size_t i = 0; i < N; ++i)
+                    next_[i] = static_cast<index_type>(i + 1);
+                next_[N] = prev_[N] = nil;
+                free_ = 0;
+                size_ = 0;
+            }
+
+            // take a free node (there must be one)
+            index_type allocate() {
+                const index_type i = free_;
+                free_ = next_[i];
+                ++size_;
+                return i;
+            }
+            void release(const index_type i) {
+                next_[i] = free_;
+                free_ = i;
+                --size_;
+            }
+
+            // link node i before pos
+            void link(const index_type pos, const index_type i) {
+                const index_type p = prev_[pos];
+                next_[p] = i;
+                prev_[i] = p;
+                next_[i] = pos;
+                prev_[pos] = i;
+            }
+            void unlink(const index_type i) {
+                next_[prev_[i]] = next_[i];
+                prev_[next_[i]] = prev_[i];
+            }
+
+            // move nodes [first, last) before pos, which must not be in [first, last)
+            void relink(const index_type pos, const index_type first, const index_type last) {
+                if (first == last || pos == first || pos == last) return;
+                const index_type back = prev_[last];
+                next_[prev_[first]] = last;
+                prev_[last] = prev_[first];
+                const index_type p = prev_[pos];
+                next_[p] = first;
+                prev_[first] = p;
+                next_[back] = pos;
+                prev_[pos] = back;
+            }
+        };
+
+        template <typename T, size_t N>
+        constexpr typename node_links<T, N>::index_type node_links<T, N>::nil;
+
+        template <typename T, size_t N>
+        struct node_storage<T, N, initialized_storage> : slot_ops<T, initialized_storage>, node_links<T, N> {
+            T nodes_[N];
+
+            node_storage()
+            : nodes_() {}
+
+            T* buffer() { return nodes_; }
+            const T* buffer() const { return nodes_; }
+        };
+
+        template <typename T, size_t N>
+        struct node_storage<T, N, uninitialized_storage> : slot_ops<T, uninitialized_storage>, node_links<T, N> {
+            alignas(T) unsigned char nodes_[sizeof(T) * N];
+
+            node_storage() {}
+            node_storage(const node_storage&) = delete;
+            node_storage& operator=(const node_storage&) = delete;
+            ~node_storage() {
+                for (size_t i = this->next_[N]; i != N; i = this->next_[i])
+                    this->destroy(buffer() + i);
+            }
+
+            T* buffer() { return reinterpret_cast<T*>(nodes_); }
+            const T* buffer() const { return reinterpret_cast<const T*>(nodes_); }
+        };
+    }  // namespace detail
+}  // namespace container
+
+namespace stdx {
+
+// doubly linked list of up to N elements in a static node pool.
+// insert/erase/splice don't move the other elements, and iterators stay valid until their element is erased.
+// if it's full, a new element is not stored (push returns push_result::rejected, insert returns end()).
+template <typename T, size_t N = ARX_LIST_DEFAULT_SIZE,
+          typename Storage = container::initialized_storage>
+class list : protected container::detail::node_storage<T, N, Storage> {
+    using storage = container::detail::node_storage<T, N, Storage>;
+    using index_type = typename storage::index_type;
+    using storage::nil;
+
+    template <typename U>
+    class basic_iterator {
+        friend list;
+
+        const list* l {nullptr};
+        index_type i {nil};
+
+        basic_iterator(const list* l, const index_type i)
+        : l(l), i(i) {}
+
+    public:
+        basic_iterator() = default;
+        // iterator -> const_iterator
+        template <typename V>
+        basic_iterator(const basic_iterator<V>& it)
+        : l(it.l), i(it.i) {}
+
+        U& operator*() const { return const_cast<U&>(l->buffer()[i]); }
+        U* operator->() const { return &**this; }
+
+        basic_iterator& operator++() {
+            i = l->next_[i];
+            return *this;
+        }
+        basic_iterator& operator--() {
+            i = l->prev_[i];
+            return *this;
+        }
+        basic_iterator operator++(int) {
+            basic_iterator it = *this;
+            ++(*this);
+            return it;
+        }
+        basic_iterator operator--(int) {
+            basic_iterator it = *this;
+            --(*this);
+            return it;
+        }
+
+        bool operator==(const basic_iterator& rhs) const { return i == rhs.i && l == rhs.l; }
+        bool operator!=(const basic_iterator& rhs) const { return !(*this == rhs); }
+
+        template <typename V>
+        friend class basic_iterator;
+    };
+
+public:
+    using value_type = T;
+    using iterator = basic_iterator<T>;
+    using const_iterator = basic_iterator<const T>;
+
+    list()
+    : storage() {}
+    list(std::initializer_list<T> lst)
+    : storage() {
+        for (auto it = lst.begin(); it != lst.end(); ++it)
+            push_back(*it);
+    }
+
+    // copy
+    list(const list& r)
+    : storage() {
+        for (const auto& v : r) push_back(v);
+    }
+
+    list& operator=(const list& r) {
+        if (this != &r) {
+            clear();
+            for (const auto& v : r) push_back(v);
+        }
+        return *this;
+    }
+
+    // move (each element is moved, the node pool can't be taken over)
+    list(list&& r)
+    : storage() {
+        move_from(r);
+    }
+
+    list& operator=(list&& r) {
+        if (this != &r) {
+            clear();
+            move_from(r);
+        }
+        return *this;
+    }
+
+    size_t size() const { return this->size_; }
+    size_t max_size() const { return N; }
+    bool empty() const { return this->size_ == 0; }
+    bool full() const { return this->size_ == N; }
+
+    const T& front() const { return this->buffer()[this->next_[N]]; }
+    T& front() { return this->buffer()[this->next_[N]]; }
+
+    const T& back() const { return this->buffer()[this->prev_[N]]; }
+    T& back() { return this->buffer()[this->prev_[N]]; }
+
+    iterator begin() { return iterator(this, this->next_[N]); }
+    iterator end() { return iterator(this, nil); }
+    const_iterator begin() const { return const_iterator(this, this->next_[N]); }
+    const_iterator end() const { return const_iterator(this, nil); }
+
+    void clear() {
+        for (index_type i = this->next_[N]; i != nil; i = this->next_[i])
+            storage::destroy(this->buffer() + i);
+        this->reset();
+    }
+
+    container::push_result push_back(const T& v) { return result(emplace(end(), v)); }
+    container::push_result push_back(T&& v) { return result(emplace(end(), container::detail::move(v))); }
+    template <class... Args>
+    container::push_result emplace_back(Args&&... args) {
+        return result(emplace(end(), container::detail::forward<Args>(args)...));
+    }
+
+    container::push_result push_front(const T& v) { return result(emplace(begin(), v)); }
+    container::push_result push_front(T&& v) { return result(emplace(begin(), container::detail::move(v))); }
+    template <class... Args>
+    container::push_result emplace_front(Args&&... args) {
+        return result(emplace(begin(), container::detail::forward<Args>(args)...));
+    }
+
+    void pop_back() {
+        if (!empty()) erase(const_iterator(this, this->prev_[N]));
+    }
+    void pop_front() {
+        if (!empty()) erase(begin());
+    }
+
+    // https://en.cppreference.com/w/cpp/container/list/insert
+    // returns end() if it's full
+    iterator insert(const_iterator pos, const T& v) {
+        return emplace(pos, v);
+    }
+    iterator insert(const_iterator pos, T&& v) {
+        return emplace(pos, container::detail::move(v));
+    }
+
+    template <class... Args>
+    iterator emplace(const_iterator pos, Args&&... args) {
+        if (full() || pos.l != this) return end();
+        const index_type i = this->allocate();
+        storage::emplace(this->buffer() + i, container::detail::forward<Args>(args)...);
+        this->link(pos.i, i);
+        return iterator(this, i);
+    }
+
+    // https://en.cppreference.com/w/cpp/container/list/erase
+    iterator erase(const_iterator pos) {
+        if (pos.l != this || pos.i == nil) return end();
+        const index_type next = this->next_[pos.i];
+        this->unlink(pos.i);
+        storage::destroy(this->buffer() + pos.i);
+        this->release(pos.i);
+        return iterator(this, next);
+    }
+
+    iterator erase(const_iterator first, const_iterator last) {
+        while (first != last) first = erase(first);
+        return iterator(this, last.i);
+    }
+
+    // https://en.cppreference.com/w/cpp/container/list/splice
+    // within the same list, nodes are only relinked in O(1).
+    // from another list, each element is moved into a node of this list (and erased from r),
+    // and the elements which don't fit are left in r.
+    void splice(const_iterator pos, list& r) {
+        splice(pos, r, r.begin(), r.end());
+    }
+
+    void splice(const_iterator pos, list& r, const_iterator it) {
+        if (it.i == nil) return;
+        splice(pos, r, it, const_iterator(&r, r.next_[it.i]));
+    }
+
+    void splice(const_iterator pos, list& r, const_iterator first, const_iterator last) {
+        if (pos.l != this) return;
+        if (&r == this) {
+            this->relink(pos.i, first.i, last.i);
+            return;
+        }
+        while (first != last && !full()) {
+            const_iterator next = first;
+            ++next;
+            emplace(pos, container::detail::move(*r.to_iterator(first)));
+            r.erase(first);
+            first = next;
+        }
+    }
+
+    // v may refer to an element to be erased, so it is copied first
+    size_t remove(const T& v) {
+        const T val(v);
+        return remove_if([&val](const T& e) { return e == val; });
+    }
+
+    template <class Pred>
+    size_t remove_if(Pred pred) {
+        const size_t before = size();
+        for (const_iterator it = begin(); it != end();) {
+            if (pred(*it))
+                it = erase(it);
+            else
+                ++it;
+        }
+        return before - size();
+    }
+
+    void reverse() {
+        for (size_t i = 0, n = size() + 1, p = N; i < n; ++i) {
+            const index_type next = this->next_[p];
+            this->next_[p] = this->prev_[p];
+            this->prev_[p] = next;
+            p = next;
+        }
+    }
+
+private:
+    static container::push_result result(const iterator& it) {
+        return (it.i == nil) ? container::push_result::rejected : container::push_result::ok;
+    }
+
+    iterator to_iterator(const const_iterator& it) {
+        return iterator(this, it.i);
+    }
+
+    void move_from(list& r) {
+        for (auto& v : r) push_back(container::detail::move(v));
+        r.clear();
+    }
+};
+
+}  // namespace stdx
+}  // namespace arx
+
+#endif  // ARX_CONTAINER_LIST_H
@@ -0,0 +1,203 @@
+#pragma once
+
+#ifndef ARX_CONTAINER_MPMC_RINGBUFFER_H
+#define ARX_CONTAINER_MPMC_RINGBUFFER_H
+
+// included from ArxContainer.h
+
+#ifdef __AVR__
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#endif
+
+// size to separate the indices written by producers and by consumers (to avoid false sharing)
+#ifndef ARX_CACHE_LINE_SIZE
+#ifdef __AVR__
+#define ARX_CACHE_LINE_SIZE 1  // no cache
+#else
+#define ARX_CACHE_LINE_SIZE 64
+#endif
+#endif  // ARX_CACHE_LINE_SIZE
+
+namespace arx {
+
+namespace container {
+    namespace detail {
+        // counter shared by any number of threads (or ISRs)
+        struct mpmc_counter {
+            volatile size_t value;
+
+#ifdef __AVR__
+            // single core: accesses wider than a byte and compare-and-swap are done with interrupts disabled
+            size_t load() const {
+                __asm__ __volatile__("" ::: "memory");
+                const uint8_t sreg = SREG;
+                cli();
+                const size_t v = value;
+                SREG = sreg;
+                __asm__ __volatile__("" ::: "memory");
+                return v;
+            }
+            void store(const size_t v) {
+                __asm__ __volatile__("" ::: "memory");
+                const uint8_t sreg = SREG;
+                cli();
+                value = v;
+                SREG = sreg;
+                __asm__ __volatile__("" ::: "memory");
+            }
+            size_t load_relaxed() const { return load(); }
+            // if value is expected, replace it with desired. otherwise expected is updated to the current value
+            bool compare_exchange(size_t& expected, const size_t desired) {
+                __asm__ __volatile__("" ::: "memory");
+                const uint8_t sreg = SREG;
+                cli();
+                const size_t v = value;
+                const bool ok = (v == expected);
+                if (ok)
+                    value = desired;
+                else
+                    expected = v;
+                SREG = sreg;
+                __asm__ __volatile__("" ::: "memory");
+                return ok;
+            }
+#else
+            size_t load() const {
+                return __atomic_load_n(&value, __ATOMIC_ACQUIRE);
+            }
+            void store(const size_t v) {
+                __atomic_store_n(&value, v, __ATOMIC_RELEASE);
+            }
+            size_t load_relaxed() const {
+                return __atomic_load_n(&value, __ATOMIC_RELAXED);
+            }
+            // if value is expected, replace it with desired. otherwise expected is updated to the current value
+            bool compare_exchange(size_t& expected, const size_t desired) {
+                return __atomic_compare_exchange_n(&value, &expected, desired, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+            }
+#endif
+        };
+
+        // a counter on its own cache line
+        struct alignas(ARX_CACHE_LINE_SIZE) mpmc_position {
+            mpmc_counter pos;
+        };
+
+        template <typename T>
+        struct mpmc_cell {
+            mpmc_counter seq;
+            T data;
+        };
+    }  // namespace detail
+}  // namespace container
+
+// Bounded lock-free queue for any number of producers and consumers (threads, RTOS tasks or ISRs),
+// based on Dmitry Vyukov's bounded MPMC queue: each slot has a sequence number which tells
+// whether it is ready to be written or read in the current lap, so a push or a pop only
+// claims a position with one compare-and-swap and never waits for a lock.
+// The positions of producers and consumers are on separate cache lines (ARX_CACHE_LINE_SIZE).
+// N must be a power of two. push fails (returns false) if it's full, and pop if it's empty.
+// Needs __atomic builtins with compare-and-swap (libatomic where the CPU has none, e.g. Cortex-M0+);
+// on AVR, interrupts are disabled for a few cycles instead.
+template <typename T, size_t N>
+class MpmcRingBuffer {
+    static_assert(N >= 2 && container::detail::is_power_of_two<N>::value, "N must be a power of two (>= 2)");
+    static constexpr size_t MASK = N - 1;
+
+    using cell = container::detail::mpmc_cell<T>;
+
+    cell cells_[N];
+    container::detail::mpmc_position enqueue_;  // written by producers
+    container::detail::mpmc_position dequeue_;  // written by consumers
+
+public:
+    MpmcRingBuffer() {
+        for (size_t i = 0; i < N; ++i) cells_[i].seq.value = i;
+        enqueue_.pos.value = 0;
+        dequeue_.pos.value = 0;
+    }
+
+    MpmcRingBuffer(const MpmcRingBuffer&) = delete;
+    MpmcRingBuffer& operator=(const MpmcRingBuffer&) = delete;
+
+    size_t capacity() const { return N; }
+
+    // only a snapshot while other threads are pushing or popping
+    size_t size() const {
+        const size_t tail = enqueue_.pos.load_relaxed();
+        const size_t head = dequeue_.pos.load_relaxed();
+        const size_t n = tail - head;
+        return n > N ? 0 : n;  // head has been loaded after newer pops
+    }
+    bool empty() const { return size() == 0; }
+    bool full() const { return size() == N; }
+
+    bool push(const T& data) {
+        size_t pos;
+        cell* c = claim_push(pos);
+        if (!c) return false;
+        c->data = data;
+        // readable in this lap
+        c->seq.store(pos + 1);
+        return true;
+    }
+
+    bool push(T&& data) {
+        size_t pos;
+        cell* c = claim_push(pos);
+        if (!c) return false;
+        c->data = container::detail::move(data);
+        // readable in this lap
+        c->seq.store(pos + 1);
+        return true;
+    }
+
+    bool pop(T& data) {
+        size_t pos = dequeue_.pos.load_relaxed();
+        cell* c;
+        for (;;) {
+            c = &cells_[pos & MASK];
+            const size_t seq = c->seq.load();
+            // subtracted as unsigned: positions wrap around (after ~32k operations on AVR)
+            const intptr_t dif = static_cast<intptr_t>(seq - (pos + 1));
+            if (dif == 0) {
+                if (dequeue_.pos.compare_exchange(pos, pos + 1)) break;
+            } else if (dif < 0) {
+                return false;  // empty (the slot has not been written in this lap)
+            } else {
+                pos = dequeue_.pos.load_relaxed();  // another consumer took it
+            }
+        }
+        data = container::detail::move(c->data);
+        // ready to be written in the next lap
+        c->seq.store(pos + MASK + 1);
+        return true;
+    }
+
+private:
+    // claim the slot at the enqueue position pos, or nullptr if it's full
+    cell* claim_push(size_t& pos) {
+        pos = enqueue_.pos.load_relaxed();
+        for (;;) {
+            cell* c = &cells_[pos & MASK];
+            const size_t seq = c->seq.load();
+            // subtracted as unsigned: positions wrap around (after ~32k operations on AVR)
+            const intptr_t dif = static_cast<intptr_t>(seq - pos);
+            if (dif == 0) {
+                if (enqueue_.pos.compare_exchange(pos, pos + 1)) return c;
+            } else if (dif < 0) {
+                return nullptr;  // full (the slot has not been read in the previous lap)
+            } else {
+                pos = enqueue_.pos.load_relaxed();  // another producer took it
+            }
+        }
+    }
+};
+
+}  // namespace arx
+
+template <typename T, size_t N>
+using ArxMpmcRingBuffer = arx::MpmcRingBuffer<T, N>;
+
+#endif  // ARX_CONTAINER_MPMC_RINGBUFFER_H
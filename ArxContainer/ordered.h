@@ -0,0 +1,367 @@
+#pragma once
+
+#ifndef ARX_CONTAINER_ORDERED_H
+#define ARX_CONTAINER_ORDERED_H
+
+// included from ArxContainer.h
+
+namespace arx {
+
+namespace container {
+    namespace detail {
+        // fixed-capacity array of values sorted by key, shared by set, multiset, multimap and flat_map.
+        // lookups are binary searches (O(log N) comparisons) and iteration is in key order.
+        // equal keys are kept in insertion order (a new one is inserted after them, as std::multimap).
+        // insert/erase shift the following elements (memmove for trivially copyable ones).
+        // Iterator is const Value* for sets (elements are keys and can't be modified in place).
+        template <class Value, class Key, class Compare, size_t N, typename Storage, typename Iterator>
+        class sorted_table : protected stdx::vector<Value, N, Storage, overflow::reject> {
+        protected:
+            using base = stdx::vector<Value, N, Storage, overflow::reject>;
+
+        public:
+            using key_type = Key;
+            using value_type = Value;
+            using key_compare = Compare;
+            using iterator = Iterator;
+            using const_iterator = const Value*;
+
+            sorted_table()
+            : base() {}
+
+            // copy
+            sorted_table(const sorted_table& r)
+            : base(r) {}
+
+            sorted_table& operator=(const sorted_table& r) {
+                base::operator=(r);
+                return *this;
+            }
+
+            // move
+            sorted_table(sorted_table&& r)
+            : base(container::detail::move(static_cast<base&>(r))) {}
+
+            sorted_table& operator=(sorted_table&& r) {
+                base::operator=(container::detail::move(static_cast<base&>(r)));
+                return *this;
+            }
+
+            using base::capacity;
+            using base::clear;
+            using base::empty;
+            using base::size;
+
+            iterator begin() { return base::begin(); }
+            iterator end() { return base::end(); }
+            const_iterator begin() const { return base::begin(); }
+            const_iterator end() const { return base::end(); }
+
+            key_compare key_comp() const { return key_compare(); }
+
+            // first element whose key is not less than key
+            iterator lower_bound(const Key& key) {
+                return begin() + lower_index(key);
+            }
+            const_iterator lower_bound(const Key& key) const {
+                return begin() + lower_index(key);
+            }
+
+            // first element whose key is greater than key
+            iterator upper_bound(const Key& key) {
+                return begin() + upper_index(key);
+            }
+            const_iterator upper_bound(const Key& key) const {
+                return begin() + upper_index(key);
+            }
+
+            // [lower_bound(key), upper_bound(key)): the elements of key
+            stdx::pair<iterator, iterator> equal_range(const Key& key) {
+                const size_t first = lower_index(key);
+                return {begin() + first, begin() + upper_index(key, first)};
+            }
+            stdx::pair<const_iterator, const_iterator> equal_range(const Key& key) const {
+                const size_t first = lower_index(key);
+                return {begin() + first, begin() + upper_index(key, first)};
+            }
+
+            // the first element of key, or end()
+            iterator find(const Key& key) {
+                iterator it = lower_bound(key);
+                return is_key_at(it, key) ? it : end();
+            }
+            const_iterator find(const Key& key) const {
+                const_iterator it = lower_bound(key);
+                return is_key_at(it, key) ? it : end();
+            }
+
+            size_t count(const Key& key) const {
+                const size_t first = lower_index(key);
+                return upper_index(key, first) - first;
+            }
+
+            iterator erase(const_iterator it) {
+                return base::erase(it);
+            }
+
+            iterator erase(const_iterator first, const_iterator last) {
+                return base::erase(first, last);
+            }
+
+            // erase all the elements of key and return how many they were
+            size_t erase(const Key& key) {
+                const stdx::pair<iterator, iterator> r = equal_range(key);
+                const size_t n = static_cast<size_t>(r.second - r.first);
+                if (n) base::erase(r.first, r.second);
+                return n;
+            }
+
+            friend bool operator==(const sorted_table& x, const sorted_table& y) {
+                if (x.size() != y.size()) return false;
+                for (size_t i = 0; i < x.size(); ++i)
+                    if (!(x.data()[i] == y.data()[i])) return false;
+                return true;
+            }
+            friend bool operator!=(const sorted_table& x, const sorted_table& y) {
+                return !(x == y);
+            }
+
+        protected:
+            static const Key& key_at(const Value& v) { return key_of<Key>::get(v); }
+
+            // binary search over [begin(), end())
+            size_t lower_index(const Key& key) const {
+                const Value* p = this->data();
+                size_t first = 0;
+                size_t n = size();
+                while (n > 0) {
+                    const size_t half = n / 2;
+                    if (key_comp()(key_at(p[first + half]), key)) {
+                        first += half + 1;
+                        n -= half + 1;
+                    } else {
+                        n = half;
+                    }
+                }
+                return first;
+            }
+
+            // binary search over [begin() + first, end())
+            size_t upper_index(const Key& key, size_t first = 0) const {
+                const Value* p = this->data();
+                size_t n = size() - first;
+                while (n > 0) {
+                    const size_t half = n / 2;
+                    if (!key_comp()(key, key_at(p[first + half]))) {
+                        first += half + 1;
+                        n -= half + 1;
+                    } else {
+                        n = half;
+                    }
+                }
+                return first;
+            }
+
+            bool is_key_at(const_iterator it, const Key& key) const {
+                return it != end() && !key_comp()(key, key_at(*it));
+            }
+
+            // end() if it's full
+            // args must not refer to the elements (they may be shifted before construction)
+            template <class... Args>
+            iterator emplace_at(const_iterator pos, Args&&... args) {
+                if (size() == N) return end();
+                return base::emplace(pos, container::detail::forward<Args>(args)...);
+            }
+        };
+    }  // namespace detail
+}  // namespace container
+
+namespace stdx {
+
+// set of unique keys sorted by Compare in a contiguous array (see sorted_table)
+// if it's full, a new key is not inserted (insert() returns {end(), false})
+template <class Key, size_t N = ARX_SET_DEFAULT_SIZE,
+          class Compare = less<Key>,
+          typename Storage = container::initialized_storage>
+struct set : public container::detail::sorted_table<Key, Key, Compare, N, Storage, const Key*> {
+    using base = container::detail::sorted_table<Key, Key, Compare, N, Storage, const Key*>;
+    using iterator = typename base::iterator;
+    using const_iterator = typename base::const_iterator;
+    using value_compare = Compare;
+
+    set()
+    : base() {}
+    set(std::initializer_list<Key> lst)
+    : base() {
+        for (auto it = lst.begin(); it != lst.end(); ++it)
+            insert(*it);
+    }
+
+    // copy
+    set(const set& r)
+    : base(r) {}
+
+    set& operator=(const set& r) {
+        base::operator=(r);
+        return *this;
+    }
+
+    // move
+    set(set&& r)
+    : base(container::detail::move(r)) {}
+
+    set& operator=(set&& r) {
+        base::operator=(container::detail::move(r));
+        return *this;
+    }
+
+    value_compare value_comp() const { return value_compare(); }
+
+    pair<iterator, bool> insert(const Key& key) {
+        return emplace_key(key);
+    }
+
+    pair<iterator, bool> insert(Key&& key) {
+        return emplace_key(container::detail::move(key));
+    }
+
+    template <class... Args>
+    pair<iterator, bool> emplace(Args&&... args) {
+        return emplace_key(Key(container::detail::forward<Args>(args)...));
+    }
+
+private:
+    // a key which is not found is not one of the elements, so it can be passed to emplace_at as is
+    template <class K>
+    pair<iterator, bool> emplace_key(K&& key) {
+        iterator it = this->lower_bound(key);
+        if (this->is_key_at(it, key)) return {it, false};
+        it = this->emplace_at(it, container::detail::forward<K>(key));
+        return {it, it != this->end()};
+    }
+};
+
+// sorted keys which may be equal (see sorted_table)
+// if it's full, a new key is not inserted (insert() returns end())
+template <class Key, size_t N = ARX_SET_DEFAULT_SIZE,
+          class Compare = less<Key>,
+          typename Storage = container::initialized_storage>
+struct multiset : public container::detail::sorted_table<Key, Key, Compare, N, Storage, const Key*> {
+    using base = container::detail::sorted_table<Key, Key, Compare, N, Storage, const Key*>;
+    using iterator = typename base::iterator;
+    using const_iterator = typename base::const_iterator;
+    using value_compare = Compare;
+
+    multiset()
+    : base() {}
+    multiset(std::initializer_list<Key> lst)
+    : base() {
+        for (auto it = lst.begin(); it != lst.end(); ++it)
+            insert(*it);
+    }
+
+    // copy
+    multiset(const multiset& r)
+    : base(r) {}
+
+    multiset& operator=(const multiset& r) {
+        base::operator=(r);
+        return *this;
+    }
+
+    // move
+    multiset(multiset&& r)
+    : base(container::detail::move(r)) {}
+
+    multiset& operator=(multiset&& r) {
+        base::operator=(container::detail::move(r));
+        return *this;
+    }
+
+    value_compare value_comp() const { return value_compare(); }
+
+    // key may be one of the elements, so it is copied before the others are shifted
+    iterator insert(const Key& key) {
+        return insert(Key(key));
+    }
+
+    iterator insert(Key&& key) {
+        return this->emplace_at(this->begin() + this->upper_index(key), container::detail::move(key));
+    }
+
+    template <class... Args>
+    iterator emplace(Args&&... args) {
+        return insert(Key(container::detail::forward<Args>(args)...));
+    }
+};
+
+// map whose keys may be equal, sorted by Compare in a contiguous array (see sorted_table)
+// if it's full, a new element is not inserted (insert() returns end())
+// iterators point to pair<Key, T>: don't assign to it->first, which breaks the order that lookups rely on.
+template <class Key, class T, size_t N = ARX_MAP_DEFAULT_SIZE,
+          class Compare = less<Key>,
+          typename Storage = container::initialized_storage>
+struct multimap : public container::detail::sorted_table<pair<Key, T>, Key, Compare, N, Storage, pair<Key, T>*> {
+    using base = container::detail::sorted_table<pair<Key, T>, Key, Compare, N, Storage, pair<Key, T>*>;
+    using mapped_type = T;
+    using value_type = pair<Key, T>;
+    using iterator = typename base::iterator;
+    using const_iterator = typename base::const_iterator;
+
+    multimap()
+    : base() {}
+    multimap(std::initializer_list<value_type> lst)
+    : base() {
+        for (auto it = lst.begin(); it != lst.end(); ++it)
+            insert(*it);
+    }
+
+    // copy
+    multimap(const multimap& r)
+    : base(r) {}
+
+    multimap& operator=(const multimap& r) {
+        base::operator=(r);
+        return *this;
+    }
+
+    // move
+    multimap(multimap&& r)
+    : base(container::detail::move(r)) {}
+
+    multimap& operator=(multimap&& r) {
+        base::operator=(container::detail::move(r));
+        return *this;
+    }
+
+    // key and t may refer to the elements, so they are copied before the others are shifted
+    iterator insert(const Key& key, const T& t) {
+        return insert(value_type(key, t));
+    }
+
+    iterator insert(const value_type& p) {
+        return insert(value_type(p));
+    }
+
+    iterator insert(value_type&& p) {
+        return this->emplace_at(this->begin() + this->upper_index(p.first), container::detail::move(p));
+    }
+
+    iterator emplace(const Key& key, const T& t) {
+        return insert(key, t);
+    }
+
+    iterator emplace(const value_type& p) {
+        return insert(p);
+    }
+
+    iterator emplace(value_type&& p) {
+        return insert(container::detail::move(p));
+    }
+};
+
+}  // namespace stdx
+}  // namespace arx
+
+#endif  // ARX_CONTAINER_ORDERED_H
@@ -0,0 +1,160 @@
+#pragma once
+
+#ifndef ARX_CONTAINER_PRIORITY_QUEUE_H
+#define ARX_CONTAINER_PRIORITY_QUEUE_H
+
+// included from ArxContainer.h
+
+namespace arx {
+
+namespace container {
+    namespace detail {
+        template <class It>
+        struct iterator_value {
+            using type = typename remove_const<typename remove_reference<decltype(*declval<It&>())>::type>::type;
+        };
+
+        // move the element at hole up to its place in the heap [first, first + hole]
+        template <class It, class Compare>
+        void sift_up(It first, int hole, Compare& comp) {
+            typename iterator_value<It>::type v = detail::move(*(first + hole));
+            while (hole > 0) {
+                const int parent = (hole - 1) / 2;
+                if (!comp(*(first + parent), v)) break;
+                *(first + hole) = detail::move(*(first + parent));
+                hole = parent;
+            }
+            *(first + hole) = detail::move(v);
+        }
+
+        // move the element at hole down to its place in the heap [first, first + len)
+        template <class It, class Compare>
+        void sift_down(It first, const int len, int hole, Compare& comp) {
+            typename iterator_value<It>::type v = detail::move(*(first + hole));
+            while (true) {
+                int child = 2 * hole + 1;
+                if (child >= len) break;
+                if (child + 1 < len && comp(*(first + child), *(first + (child + 1)))) ++child;
+                if (!comp(v, *(first + child))) break;
+                *(first + hole) = detail::move(*(first + child));
+                hole = child;
+            }
+            *(first + hole) = detail::move(v);
+        }
+    }  // namespace detail
+}  // namespace container
+
+namespace stdx {
+
+// binary max-heap algorithms on random access iterators (pointers of vector, iterators of RingBuffer / deque)
+// https://en.cppreference.com/w/cpp/algorithm/push_heap
+
+// [first, last - 1) is a heap: add *(last - 1) to it
+template <class It, class Compare>
+void push_heap(It first, It last, Compare comp) {
+    const int len = static_cast<int>(last - first);
+    if (len > 1) container::detail::sift_up(first, len - 1, comp);
+}
+
+template <class It>
+void push_heap(It first, It last) {
+    stdx::push_heap(first, last, less<typename container::detail::iterator_value<It>::type>());
+}
+
+// move the largest element to last - 1, and [first, last - 1) is a heap again
+template <class It, class Compare>
+void pop_heap(It first, It last, Compare comp) {
+    const int len = static_cast<int>(last - first);
+    if (len < 2) return;
+    typename container::detail::iterator_value<It>::type top = container::detail::move(*first);
+    *first = container::detail::move(*(first + (len - 1)));
+    *(first + (len - 1)) = container::detail::move(top);
+    container::detail::sift_down(first, len - 1, 0, comp);
+}
+
+template <class It>
+void pop_heap(It first, It last) {
+    stdx::pop_heap(first, last, less<typename container::detail::iterator_value<It>::type>());
+}
+
+// O(N)
+template <class It, class Compare>
+void make_heap(It first, It last, Compare comp) {
+    const int len = static_cast<int>(last - first);
+    for (int i = len / 2 - 1; i >= 0; --i)
+        container::detail::sift_down(first, len, i, comp);
+}
+
+template <class It>
+void make_heap(It first, It last) {
+    stdx::make_heap(first, last, less<typename container::detail::iterator_value<It>::type>());
+}
+
+// heap of up to N elements on a vector: top() is the largest element by Compare
+// (use greater<T> to get the smallest one first, e.g. the nearest deadline).
+// push() and pop() take O(log N).
+// if it's full, a new element is not pushed (push() returns push_result::rejected).
+template <class T, size_t N = ARX_PRIORITY_QUEUE_DEFAULT_SIZE,
+          class Compare = less<T>,
+          typename Storage = container::initialized_storage>
+class priority_queue {
+public:
+    using container_type = vector<T, N, Storage, container::overflow::reject>;
+    using value_type = T;
+    using value_compare = Compare;
+
+protected:
+    container_type c;
+    Compare comp;
+
+public:
+    priority_queue()
+    : c(), comp() {}
+    explicit priority_queue(const Compare& compare)
+    : c(), comp(compare) {}
+    priority_queue(std::initializer_list<T> lst, const Compare& compare = Compare())
+    : c(), comp(compare) {
+        c.assign(lst.begin(), lst.end());
+        stdx::make_heap(c.begin(), c.end(), comp);
+    }
+
+    size_t capacity() const { return N; }
+    size_t size() const { return c.size(); }
+    bool empty() const { return c.empty(); }
+    bool full() const { return c.size() == N; }
+
+    const T& top() const { return c.front(); }
+
+    container::push_result push(const T& v) {
+        if (full()) return container::push_result::rejected;
+        c.push_back(v);
+        stdx::push_heap(c.begin(), c.end(), comp);
+        return container::push_result::ok;
+    }
+    container::push_result push(T&& v) {
+        if (full()) return container::push_result::rejected;
+        c.push_back(container::detail::move(v));
+        stdx::push_heap(c.begin(), c.end(), comp);
+        return container::push_result::ok;
+    }
+    template <class... Args>
+    container::push_result emplace(Args&&... args) {
+        if (full()) return container::push_result::rejected;
+        c.emplace_back(container::detail::forward<Args>(args)...);
+        stdx::push_heap(c.begin(), c.end(), comp);
+        return container::push_result::ok;
+    }
+
+    void pop() {
+        if (empty()) return;
+        stdx::pop_heap(c.begin(), c.end(), comp);
+        c.pop_back();
+    }
+
+    void clear() { c.clear(); }
+};
+
+}  // namespace stdx
+}  // namespace arx
+
+#endif  // ARX_CONTAINER_PRIORITY_QUEUE_H
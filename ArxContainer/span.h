@@ -0,0 +1,347 @@
+#pragma once
+
+#ifndef ARX_CONTAINER_SPAN_H
+#define ARX_CONTAINER_SPAN_H
+
+// included from ArxContainer.h
+
+namespace arx {
+
+namespace container {
+    namespace detail {
+        // ordered.h
+        template <class Value, class Key, class Compare, size_t N, typename Storage, typename Iterator>
+        class sorted_table;
+    }  // namespace detail
+}  // namespace container
+
+namespace stdx {
+
+// non-owning view of contiguous elements (vector, array, flat_map, set, raw array, pointer and size).
+// a function taking span<const T> accepts any of them regardless of N,
+// so only one instance of the function is compiled.
+// out-of-range first()/last()/subspan() are clamped instead of being undefined.
+template <typename T>
+class span {
+    T* data_ {nullptr};
+    size_t size_ {0};
+
+public:
+    using element_type = T;
+    using value_type = typename container::detail::remove_const<T>::type;
+    using iterator = T*;
+
+    span() = default;
+    span(T* data, const size_t size)
+    : data_(data), size_(size) {}
+    span(T* first, T* last)
+    : data_(first), size_(static_cast<size_t>(last - first)) {}
+    template <size_t N>
+    span(T (&arr)[N])
+    : data_(arr), size_(N) {}
+    template <typename U, size_t N, typename S, typename O>
+    span(vector<U, N, S, O>& v)
+    : data_(v.data()), size_(v.size()) {}
+    template <typename U, size_t N, typename S, typename O>
+    span(const vector<U, N, S, O>& v)
+    : data_(v.data()), size_(v.size()) {}
+    template <typename U, size_t N, typename S>
+    span(array<U, N, S>& a)
+    : data_(a.data()), size_(N) {}
+    template <typename U, size_t N, typename S>
+    span(const array<U, N, S>& a)
+    : data_(a.data()), size_(N) {}
+    // flat_map, set, multiset and multimap (only as span<const T>: the elements must stay sorted)
+    template <typename V, typename K, typename C, size_t N, typename S, typename I>
+    span(const container::detail::sorted_table<V, K, C, N, S, I>& t)
+    : data_(t.begin()), size_(t.size()) {}
+    // span<T> -> span<const T>
+    template <typename U>
+    span(const span<U>& s)
+    : data_(s.data()), size_(s.size()) {}
+
+    T* data() const { return data_; }
+    size_t size() const { return size_; }
+    size_t size_bytes() const { return size_ * sizeof(T); }
+    bool empty() const { return size_ == 0; }
+
+    T& operator[](const size_t i) const { return data_[i]; }
+    T& front() const { return data_[0]; }
+    T& back() const { return data_[size_ - 1]; }
+
+    iterator begin() const { return data_; }
+    iterator end() const { return data_ + size_; }
+
+    span first(size_t n) const {
+        if (n > size_) n = size_;
+        return span(data_, n);
+    }
+    span last(size_t n) const {
+        if (n > size_) n = size_;
+        return span(data_ + size_ - n, n);
+    }
+    span subspan(size_t offset, size_t count = static_cast<size_t>(-1)) const {
+        if (offset > size_) offset = size_;
+        if (count > size_ - offset) count = size_ - offset;
+        return span(data_ + offset, count);
+    }
+};
+
+// non-owning view of the elements of a RingBuffer (and deque),
+// which are at most two contiguous segments: first_segment() and then second_segment().
+// contiguous data (span, vector, array, raw array) is also accepted as a single segment,
+// so a parser taking ring_span<const T> can read any container without copying it.
+template <typename T>
+class ring_span {
+    span<T> first_;
+    span<T> second_;
+
+public:
+    using element_type = T;
+    using value_type = typename container::detail::remove_const<T>::type;
+
+    // forward iterator which jumps from the end of the first segment to the second
+    class iterator {
+        friend ring_span;
+
+        T* p {nullptr};
+        T* first_end {nullptr};
+        T* second_begin {nullptr};
+
+        iterator(T* p, T* first_end, T* second_begin)
+        : p(p), first_end(first_end), second_begin(second_begin) {}
+
+    public:
+        iterator() = default;
+
+        T& operator*() const { return *p; }
+        T* operator->() const { return p; }
+
+        // first_end is cleared after the jump, because the end of the second segment
+        // can be the same address as the beginning of the first one
+        iterator& operator++() {
+            if (++p == first_end) {
+                p = second_begin;
+                first_end = nullptr;
+            }
+            return *this;
+        }
+        iterator operator++(int) {
+            iterator it = *this;
+            ++(*this);
+            return it;
+        }
+
+        bool operator==(const iterator& rhs) const { return p == rhs.p && first_end == rhs.first_end; }
+        bool operator!=(const iterator& rhs) const { return !(*this == rhs); }
+    };
+
+    ring_span() = default;
+    ring_span(const span<T>& first, const span<T>& second)
+    : first_(first), second_(second) {
+        normalize();
+    }
+    template <typename U>
+    ring_span(const span<U>& s)
+    : first_(s) {}
+    template <typename U>
+    ring_span(const container::segments<U>& s)
+    : first_(s.first.data, s.first.size), second_(s.second.data, s.second.size) {
+        normalize();
+    }
+    template <typename U, size_t N, typename S, typename O>
+    ring_span(RingBuffer<U, N, S, O>& r)
+    : ring_span(r.linear_segments()) {}
+    template <typename U, size_t N, typename S, typename O>
+    ring_span(const RingBuffer<U, N, S, O>& r)
+    : ring_span(r.linear_segments()) {}
+    template <size_t N>
+    ring_span(T (&arr)[N])
+    : first_(arr) {}
+    template <typename U, size_t N, typename S, typename O>
+    ring_span(vector<U, N, S, O>& v)
+    : first_(v) {}
+    template <typename U, size_t N, typename S, typename O>
+    ring_span(const vector<U, N, S, O>& v)
+    : first_(v) {}
+    template <typename U, size_t N, typename S>
+    ring_span(array<U, N, S>& a)
+    : first_(a) {}
+    template <typename U, size_t N, typename S>
+    ring_span(const array<U, N, S>& a)
+    : first_(a) {}
+    // ring_span<T> -> ring_span<const T>
+    template <typename U>
+    ring_span(const ring_span<U>& r)
+    : first_(r.first_segment()), second_(r.second_segment()) {}
+
+    const span<T>& first_segment() const { return first_; }
+    const span<T>& second_segment() const { return second_; }
+
+    size_t size() const { return first_.size() + second_.size(); }
+    size_t size_bytes() const { return size() * sizeof(T); }
+    bool empty() const { return size() == 0; }
+
+    T& operator[](const size_t i) const {
+        return (i < first_.size()) ? first_[i] : second_[i - first_.size()];
+    }
+    T& front() const { return (*this)[0]; }
+    T& back() const { return (*this)[size() - 1]; }
+
+    iterator begin() const {
+        if (empty()) return end();
+        return iterator(first_.data(), first_.end(), second_.empty() ? first_.end() : second_.data());
+    }
+    iterator end() const {
+        return iterator(second_.empty() ? first_.end() : second_.end(), nullptr, nullptr);
+    }
+
+    ring_span first(size_t n) const {
+        return subspan(0, n);
+    }
+    ring_span last(size_t n) const {
+        if (n > size()) n = size();
+        return subspan(size() - n, n);
+    }
+    ring_span subspan(size_t offset, size_t count = static_cast<size_t>(-1)) const {
+        if (offset > size()) offset = size();
+        if (count > size() - offset) count = size() - offset;
+        if (offset >= first_.size())
+            return ring_span(second_.subspan(offset - first_.size(), count));
+        const span<T> head = first_.subspan(offset, count);
+        return ring_span(head, second_.first(count - head.size()));
+    }
+
+private:
+    // the first segment is empty only if both are
+    void normalize() {
+        if (first_.empty()) {
+            first_ = second_;
+            second_ = span<T>();
+        }
+    }
+};
+
+// non-owning view of characters (not null-terminated).
+// the viewed string must outlive the view (e.g. don't make it from a temporary String).
+// only basic_string_view<char> (string_view) is supported.
+template <typename CharT>
+class basic_string_view {
+    const CharT* data_ {nullptr};
+    size_t size_ {0};
+
+public:
+    using value_type = CharT;
+    using iterator = const CharT*;
+    using const_iterator = const CharT*;
+
+    static constexpr size_t npos = static_cast<size_t>(-1);
+
+    basic_string_view() = default;
+    basic_string_view(const CharT* s)
+    : data_(s), size_(s ? strlen(s) : 0) {}
+    basic_string_view(const CharT* s, const size_t n)
+    : data_(s), size_(n) {}
+    basic_string_view(const span<const CharT>& s)
+    : data_(s.data()), size_(s.size()) {}
+#ifdef ARDUINO
+    basic_string_view(const String& s)
+    : data_(s.c_str()), size_(s.length()) {}
+#endif
+
+    const CharT* data() const { return data_; }
+    size_t size() const { return size_; }
+    size_t length() const { return size_; }
+    bool empty() const { return size_ == 0; }
+
+    const CharT& operator[](const size_t i) const { return data_[i]; }
+    const CharT& front() const { return data_[0]; }
+    const CharT& back() const { return data_[size_ - 1]; }
+
+    const_iterator begin() const { return data_; }
+    const_iterator end() const { return data_ + size_; }
+
+    void remove_prefix(size_t n) {
+        if (n > size_) n = size_;
+        data_ += n;
+        size_ -= n;
+    }
+    void remove_suffix(size_t n) {
+        if (n > size_) n = size_;
+        size_ -= n;
+    }
+
+    basic_string_view substr(size_t pos, size_t count = npos) const {
+        if (pos > size_) pos = size_;
+        if (count > size_ - pos) count = size_ - pos;
+        return basic_string_view(data_ + pos, count);
+    }
+
+    int compare(const basic_string_view& s) const {
+        const size_t n = size_ < s.size_ ? size_ : s.size_;
+        const int r = n ? memcmp(data_, s.data_, n) : 0;
+        if (r != 0) return r;
+        return (size_ < s.size_) ? -1 : (size_ > s.size_) ? 1 : 0;
+    }
+
+    bool starts_with(const basic_string_view& s) const {
+        return size_ >= s.size_ && substr(0, s.size_).compare(s) == 0;
+    }
+    bool starts_with(const CharT c) const {
+        return !empty() && front() == c;
+    }
+    bool ends_with(const basic_string_view& s) const {
+        return size_ >= s.size_ && substr(size_ - s.size_).compare(s) == 0;
+    }
+    bool ends_with(const CharT c) const {
+        return !empty() && back() == c;
+    }
+
+    size_t find(const CharT c, const size_t pos = 0) const {
+        for (size_t i = pos; i < size_; ++i)
+            if (data_[i] == c) return i;
+        return npos;
+    }
+    size_t find(const basic_string_view& s, const size_t pos = 0) const {
+        if (s.size_ == 0) return (pos <= size_) ? pos : npos;
+        if (s.size_ > size_) return npos;
+        for (size_t i = pos; i <= size_ - s.size_; ++i)
+            if (memcmp(data_ + i, s.data_, s.size_) == 0) return i;
+        return npos;
+    }
+    size_t rfind(const CharT c, const size_t pos = npos) const {
+        for (size_t i = (pos < size_) ? pos + 1 : size_; i-- > 0;)
+            if (data_[i] == c) return i;
+        return npos;
+    }
+
+    // defined as friends so that both sides can be converted (e.g. "abc" == sv)
+    friend bool operator==(const basic_string_view& x, const basic_string_view& y) {
+        return x.size_ == y.size_ && x.compare(y) == 0;
+    }
+    friend bool operator!=(const basic_string_view& x, const basic_string_view& y) {
+        return !(x == y);
+    }
+    friend bool operator<(const basic_string_view& x, const basic_string_view& y) {
+        return x.compare(y) < 0;
+    }
+    friend bool operator>(const basic_string_view& x, const basic_string_view& y) {
+        return x.compare(y) > 0;
+    }
+    friend bool operator<=(const basic_string_view& x, const basic_string_view& y) {
+        return x.compare(y) <= 0;
+    }
+    friend bool operator>=(const basic_string_view& x, const basic_string_view& y) {
+        return x.compare(y) >= 0;
+    }
+};
+
+template <typename CharT>
+constexpr size_t basic_string_view<CharT>::npos;
+
+using string_view = basic_string_view<char>;
+
+}  // namespace stdx
+}  // namespace arx
+
+#endif  // ARX_CONTAINER_SPAN_H
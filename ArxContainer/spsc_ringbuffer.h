@@ -0,0 +1,192 @@
+#pragma once
+
+#ifndef ARX_CONTAINER_SPSC_RINGBUFFER_H
+#define ARX_CONTAINER_SPSC_RINGBUFFER_H
+
+#ifdef __AVR__
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#endif
+
+namespace arx {
+
+namespace container {
+    namespace detail {
+        // index shared between one producer and one consumer (thread or ISR)
+        // only the owner stores it (release), and the other side loads it (acquire)
+        template <typename Index>
+        struct spsc_index {
+            volatile Index value {0};
+
+#ifdef __AVR__
+            // single core: a compiler barrier is enough to order the accesses,
+            // but indices wider than a byte must not be torn by an interrupt
+            Index load() const {
+                __asm__ __volatile__("" ::: "memory");
+                Index v;
+                if (sizeof(Index) == 1) {
+                    v = value;
+                } else {
+                    const uint8_t sreg = SREG;
+                    cli();
+                    v = value;
+                    SREG = sreg;
+                }
+                __asm__ __volatile__("" ::: "memory");
+                return v;
+            }
+            void store(const Index v) {
+                __asm__ __volatile__("" ::: "memory");
+                if (sizeof(Index) == 1) {
+                    value = v;
+                } else {
+                    const uint8_t sreg = SREG;
+                    cli();
+                    value = v;
+                    SREG = sreg;
+                }
+                __asm__ __volatile__("" ::: "memory");
+            }
+#else
+            Index load() const {
+                return __atomic_load_n(&value, __ATOMIC_ACQUIRE);
+            }
+            void store(const Index v) {
+                __atomic_store_n(&value, v, __ATOMIC_RELEASE);
+            }
+#endif
+            // the owner can read its own index without synchronization
+            Index owned() const {
+                return value;
+            }
+        };
+    }  // namespace detail
+}  // namespace container
+
+// Lock-free ring buffer for exactly one producer and one consumer,
+// e.g. an ISR pushing received data and loop() popping it.
+// The producer only writes tail_ and the consumer only writes head_,
+// and push fails (returns false / fewer elements) if the buffer is full.
+template <typename T, size_t N>
+class SpscRingBuffer {
+    // one extra slot to tell full from empty
+    static constexpr size_t SLOTS = N + 1;
+    using index_t = typename container::detail::least_uint<SLOTS>::type;
+
+    T queue_[SLOTS];
+    container::detail::spsc_index<index_t> head_;  // written by consumer
+    container::detail::spsc_index<index_t> tail_;  // written by producer
+
+public:
+    SpscRingBuffer()
+    : queue_() {}
+
+    SpscRingBuffer(const SpscRingBuffer&) = delete;
+    SpscRingBuffer& operator=(const SpscRingBuffer&) = delete;
+
+    size_t capacity() const { return N; }
+
+    // can be called from both sides, but is only a snapshot
+    size_t size() const {
+        const index_t head = head_.load();
+        const index_t tail = tail_.load();
+        return (tail >= head) ? (tail - head) : (SLOTS - head + tail);
+    }
+    bool empty() const { return head_.load() == tail_.load(); }
+    bool full() const { return next(tail_.load()) == head_.load(); }
+
+    // ---------- producer side ----------
+
+    bool push(const T& data) {
+        const index_t tail = tail_.owned();
+        const index_t nxt = next(tail);
+        if (nxt == head_.load()) return false;
+        queue_[tail] = data;
+        tail_.store(nxt);
+        return true;
+    }
+
+    bool push(T&& data) {
+        const index_t tail = tail_.owned();
+        const index_t nxt = next(tail);
+        if (nxt == head_.load()) return false;
+        queue_[tail] = container::detail::move(data);
+        tail_.store(nxt);
+        return true;
+    }
+
+    // push up to n elements and return the number of elements pushed
+    size_t push(const T* src, size_t n) {
+        const index_t tail = tail_.owned();
+        const index_t head = head_.load();
+        const size_t space = (head > tail) ? (head - tail - 1) : (SLOTS - tail + head - 1);
+        if (n > space) n = space;
+        const size_t first = (n < SLOTS - tail) ? n : (SLOTS - tail);
+        copy(queue_ + tail, src, first);
+        copy(queue_, src + first, n - first);
+        tail_.store(static_cast<index_t>((tail + n < SLOTS) ? (tail + n) : (tail + n - SLOTS)));
+        return n;
+    }
+
+    // ---------- consumer side ----------
+
+    bool pop(T& data) {
+        const index_t head = head_.owned();
+        if (head == tail_.load()) return false;
+        data = container::detail::move(queue_[head]);
+        head_.store(next(head));
+        return true;
+    }
+
+    // pop up to n elements and return the number of elements popped
+    size_t pop(T* dst, size_t n) {
+        const size_t len = peek(dst, n);
+        const index_t head = head_.owned();
+        head_.store(static_cast<index_t>((head + len < SLOTS) ? (head + len) : (head + len - SLOTS)));
+        return len;
+    }
+
+    // copy up to n elements without removing them and return the number of elements copied
+    size_t peek(T* dst, size_t n) const {
+        const index_t head = head_.owned();
+        const index_t tail = tail_.load();
+        const size_t len = (tail >= head) ? (tail - head) : (SLOTS - head + tail);
+        if (n > len) n = len;
+        const size_t first = (n < SLOTS - head) ? n : (SLOTS - head);
+        copy(dst, queue_ + head, first);
+        copy(dst + first, queue_, n - first);
+        return n;
+    }
+
+    bool peek(T& data) const {
+        const index_t head = head_.owned();
+        if (head == tail_.load()) return false;
+        data = queue_[head];
+        return true;
+    }
+
+    // discard all elements (consumer side)
+    void clear() {
+        head_.store(tail_.load());
+    }
+
+private:
+    static index_t next(const index_t i) {
+        return (i + 1 == SLOTS) ? 0 : static_cast<index_t>(i + 1);
+    }
+
+    static void copy(T* dst, const T* src, const size_t n) {
+        if (container::detail::is_trivially_copyable<T>::value) {
+            memcpy(static_cast<void*>(dst), static_cast<const void*>(src), n * sizeof(T));
+        } else {
+            for (size_t i = 0; i < n; ++i) dst[i] = src[i];
+        }
+    }
+};
+
+}  // namespace arx
+
+template <typename T, size_t N>
+using ArxSpscRingBuffer = arx::SpscRingBuffer<T, N>;
+
+#endif  // ARX_CONTAINER_SPSC_RINGBUFFER_H
@@ -0,0 +1,583 @@
+#pragma once
+
+#ifndef ARX_CONTAINER_UNORDERED_H
+#define ARX_CONTAINER_UNORDERED_H
+
+// included from ArxContainer.h
+
+namespace arx {
+
+namespace container {
+    namespace detail {
+        constexpr size_t next_power_of_two(const size_t n, const size_t p = 1) {
+            return (p >= n) ? p : next_power_of_two(n, p * 2);
+        }
+
+        // number of slots of a hash table which holds up to N elements:
+        // a power of two (the index is masked) with at least N / 4 + 1 slots always free
+        template <size_t N>
+        struct hash_slots {
+            static constexpr size_t value = next_power_of_two(N + N / 4 + 1);
+        };
+
+        // erased slots (tombstones) keep the probe sequences of the other keys going
+        enum class slot_state : uint8_t {
+            empty,
+            used,
+            erased,
+        };
+
+        template <typename T, size_t M, typename Storage>
+        struct hash_storage;
+
+        template <typename T, size_t M>
+        struct hash_storage<T, M, initialized_storage> : slot_ops<T, initialized_storage> {
+            T slots_[M];
+            slot_state state_[M];
+
+            hash_storage()
+            : slots_()
+            , state_() {}
+
+            T* buffer() { return slots_; }
+            const T* buffer() const { return slots_; }
+        };
+
+        template <typename T, size_t M>
+        struct hash_storage<T, M, uninitialized_storage> : slot_ops<T, uninitialized_storage> {
+            alignas(T) unsigned char slots_[sizeof(T) * M];
+            slot_state state_[M];
+
+            hash_storage()
+            : state_() {}
+            hash_storage(const hash_storage&) = delete;
+            hash_storage& operator=(const hash_storage&) = delete;
+            ~hash_storage() {
+                for (size_t i = 0; i < M; ++i)
+                    if (state_[i] == slot_state::used) this->destroy(buffer() + i);
+            }
+
+            T* buffer() { return reinterpret_cast<T*>(slots_); }
+            const T* buffer() const { return reinterpret_cast<const T*>(slots_); }
+        };
+
+        // key of the elements of unordered_set (the element itself) and unordered_map (first)
+        template <class Key>
+        struct key_of {
+            static const Key& get(const Key& k) { return k; }
+            template <class T>
+            static const Key& get(const stdx::pair<Key, T>& p) { return p.first; }
+        };
+
+        // fixed-capacity open addressing hash table with linear probing
+        // it has hash_slots<N>::value slots, so the probe for a missing key always ends at an empty slot
+        // unless erased slots fill the gap (then it ends after visiting all slots).
+        // erased slots (tombstones) keep erase() from moving other elements (iterators stay valid),
+        // and an insert rebuilds the table in place once they are a quarter of the slots not in use,
+        // so probes don't get longer and longer in a table which keeps inserting and erasing.
+        template <class Value, class Key, class Hash, class KeyEqual, size_t N, typename Storage>
+        class hash_table : protected hash_storage<Value, hash_slots<N>::value, Storage> {
+        protected:
+            static constexpr size_t slots = hash_slots<N>::value;
+            using storage = hash_storage<Value, slots, Storage>;
+            using index_type = typename least_uint<slots>::type;
+            using storage::state_;
+
+            typename least_uint<N>::type size_ {0};
+            index_type erased_ {0};  // number of erased slots
+
+        public:
+            class Iterator;
+            class ConstIterator {
+                friend hash_table;
+
+            protected:
+                const hash_table* table {nullptr};
+                index_type pos {0};
+
+                ConstIterator(const hash_table* table, const size_t pos)
+                : table(table), pos(static_cast<index_type>(pos)) {}
+
+            public:
+                ConstIterator() {}
+
+                const Value& operator*() const {
+                    return table->buffer()[pos];
+                }
+                const Value* operator->() const {
+                    return table->buffer() + pos;
+                }
+
+                // prefix/postfix increment
+                ConstIterator& operator++() {
+                    pos = static_cast<index_type>(table->next_used(pos + 1));
+                    return *this;
+                }
+                ConstIterator operator++(int) {
+                    ConstIterator it = *this;
+                    ++(*this);
+                    return it;
+                }
+
+                bool operator==(const ConstIterator& rhs) const {
+                    return (rhs.table == table) && (rhs.pos == pos);
+                }
+                bool operator!=(const ConstIterator& rhs) const {
+                    return !(*this == rhs);
+                }
+            };
+
+            class Iterator : public ConstIterator {
+                friend hash_table;
+
+                Iterator(const hash_table* table, const size_t pos)
+                : ConstIterator(table, pos) {}
+
+            public:
+                Iterator() = default;
+
+                Value& operator*() {
+                    return const_cast<Value&>(ConstIterator::operator*());
+                }
+                Value* operator->() {
+                    return const_cast<Value*>(ConstIterator::operator->());
+                }
+
+                // prefix/postfix increment
+                Iterator& operator++() {
+                    ConstIterator::operator++();
+                    return *this;
+                }
+                Iterator operator++(int) {
+                    Iterator it = *this;
+                    ++(*this);
+                    return it;
+                }
+            };
+
+            using iterator = Iterator;
+            using const_iterator = ConstIterator;
+
+            hash_table()
+            : storage() {}
+
+            // copy
+            hash_table(const hash_table& r)
+            : storage() {
+                copy_from(r);
+            }
+            hash_table& operator=(const hash_table& r) {
+                if (this != &r) {
+                    clear();
+                    copy_from(r);
+                }
+                return *this;
+            }
+
+            // move
+            hash_table(hash_table&& r)
+            : storage() {
+                move_from(r);
+            }
+            hash_table& operator=(hash_table&& r) {
+                if (this != &r) {
+                    clear();
+                    move_from(r);
+                }
+                return *this;
+            }
+
+            size_t size() const { return size_; }
+            size_t max_size() const { return N; }
+            size_t capacity() const { return N; }
+            size_t bucket_count() const { return slots; }
+            bool empty() const { return size_ == 0; }
+
+            void clear() {
+                for (size_t i = 0; i < slots; ++i) {
+                    if (state_[i] == slot_state::used) storage::destroy(this->buffer() + i);
+                    state_[i] = slot_state::empty;
+                }
+                size_ = 0;
+                erased_ = 0;
+            }
+
+            void reserve(size_t n) {
+                (void)n;
+                // dummy
+            }
+
+            iterator begin() { return iterator(this, next_used(0)); }
+            iterator end() { return iterator(this, slots); }
+            const_iterator begin() const { return const_iterator(this, next_used(0)); }
+            const_iterator end() const { return const_iterator(this, slots); }
+
+            iterator find(const Key& key) {
+                return iterator(this, find_slot(key));
+            }
+            const_iterator find(const Key& key) const {
+                return const_iterator(this, find_slot(key));
+            }
+
+            size_t count(const Key& key) const {
+                return (find_slot(key) != slots) ? 1 : 0;
+            }
+
+            iterator erase(const const_iterator& it) {
+                if (it.table != this || it.pos >= slots || state_[it.pos] != slot_state::used)
+                    return end();
+                erase_slot(it.pos);
+                return iterator(this, next_used(it.pos + 1));
+            }
+
+            size_t erase(const Key& key) {
+                const size_t i = find_slot(key);
+                if (i == slots) return 0;
+                erase_slot(i);
+                return 1;
+            }
+
+        protected:
+            iterator make_iterator(const size_t i) { return iterator(this, i); }
+
+            static size_t home_slot(const Key& key) {
+                return Hash()(key) & (slots - 1);
+            }
+            static size_t next_slot(const size_t i) {
+                return (i + 1) & (slots - 1);
+            }
+            static size_t prev_slot(const size_t i) {
+                return (i - 1) & (slots - 1);
+            }
+
+            size_t next_used(size_t i) const {
+                while (i < slots && state_[i] != slot_state::used) ++i;
+                return i;
+            }
+
+            // slot of the key, or slots if not found
+            size_t find_slot(const Key& key) const {
+                size_t i = home_slot(key);
+                for (size_t n = 0; n < slots; ++n, i = next_slot(i)) {
+                    if (state_[i] == slot_state::empty) break;
+                    if (state_[i] == slot_state::used && KeyEqual()(key_of<Key>::get(this->buffer()[i]), key))
+                        return i;
+                }
+                return slots;
+            }
+
+            // slot of the key if found, otherwise the first free slot on its probe sequence
+            // (or slots if the table is full)
+            size_t insert_slot(const Key& key, bool& found) const {
+                found = false;
+                size_t i = home_slot(key);
+                size_t free = slots;
+                for (size_t n = 0; n < slots; ++n, i = next_slot(i)) {
+                    if (state_[i] == slot_state::empty) {
+                        if (free == slots) free = i;
+                        break;
+                    }
+                    if (state_[i] == slot_state::erased) {
+                        if (free == slots) free = i;
+                    } else if (KeyEqual()(key_of<Key>::get(this->buffer()[i]), key)) {
+                        found = true;
+                        return i;
+                    }
+                }
+                return (size_ < N) ? free : slots;
+            }
+
+            // construct the element in the free slot i and return the slot where it ends up
+            // args may refer to the elements, so the table is rebuilt only after the new element is constructed
+            template <class... Args>
+            size_t construct_at(size_t i, Args&&... args) {
+                storage::emplace(this->buffer() + i, container::detail::forward<Args>(args)...);
+                if (state_[i] == slot_state::erased) --erased_;
+                state_[i] = slot_state::used;
+                ++size_;
+                if (erased_ != 0 && 4 * size_t(erased_) >= slots - size_) rehash_in_place(i);
+                return i;
+            }
+
+            void erase_slot(const size_t i) {
+                storage::destroy(this->buffer() + i);
+                --size_;
+                if (state_[next_slot(i)] != slot_state::empty) {
+                    state_[i] = slot_state::erased;
+                    ++erased_;
+                    return;
+                }
+                // the probe sequences end here, so the tombstones just before are not needed anymore
+                state_[i] = slot_state::empty;
+                for (size_t j = prev_slot(i); state_[j] == slot_state::erased; j = prev_slot(j)) {
+                    state_[j] = slot_state::empty;
+                    --erased_;
+                }
+            }
+
+            // drop all tombstones and put every element back as close to its home slot as possible, in O(slots)
+            // without another buffer: the elements are first marked as erased (= not placed yet), and each of them
+            // is moved to the first slot on its probe sequence which is empty or not placed yet (swapping with that one).
+            // placed elements never move again, and the slots before them on their probe sequences stay in use.
+            // tracked follows the element in that slot.
+            void rehash_in_place(size_t& tracked) {
+                for (size_t i = 0; i < slots; ++i)
+                    state_[i] = (state_[i] == slot_state::used) ? slot_state::erased : slot_state::empty;
+                Value* buf = this->buffer();
+                for (size_t i = 0; i < slots; ++i) {
+                    while (state_[i] == slot_state::erased) {
+                        size_t j = home_slot(key_of<Key>::get(buf[i]));
+                        while (state_[j] == slot_state::used) j = next_slot(j);
+                        if (j == i) {
+                            state_[i] = slot_state::used;
+                        } else if (state_[j] == slot_state::empty) {
+                            storage::put(buf + j, container::detail::move(buf[i]));
+                            storage::destroy(buf + i);
+                            state_[j] = slot_state::used;
+                            state_[i] = slot_state::empty;
+                            if (tracked == i) tracked = j;
+                        } else {
+                            // buf[j] is not placed yet: it takes over slot i and is placed in the next round
+                            Value v(container::detail::move(buf[j]));
+                            buf[j] = container::detail::move(buf[i]);
+                            buf[i] = container::detail::move(v);
+                            state_[j] = slot_state::used;
+                            if (tracked == i)
+                                tracked = j;
+                            else if (tracked == j)
+                                tracked = i;
+                        }
+                    }
+                }
+                erased_ = 0;
+            }
+
+        private:
+            void copy_from(const hash_table& r) {
+                for (size_t i = 0; i < slots; ++i) {
+                    if (r.state_[i] == slot_state::used)
+                        storage::put(this->buffer() + i, r.buffer()[i]);
+                    state_[i] = r.state_[i];
+                }
+                size_ = r.size_;
+                erased_ = r.erased_;
+            }
+
+            void move_from(hash_table& r) {
+                for (size_t i = 0; i < slots; ++i) {
+                    if (r.state_[i] == slot_state::used)
+                        storage::put(this->buffer() + i, container::detail::move(r.buffer()[i]));
+                    state_[i] = r.state_[i];
+                }
+                size_ = r.size_;
+                erased_ = r.erased_;
+                r.clear();
+            }
+        };
+    }  // namespace detail
+}  // namespace container
+
+namespace stdx {
+
+// hash map with a fixed capacity N
+// if it's full, a new key is not inserted (insert() returns {end(), false})
+template <class Key, class T, size_t N = ARX_UNORDERED_MAP_DEFAULT_SIZE,
+          class Hash = container::hash<Key>,
+          class KeyEqual = container::key_equal<Key>,
+          typename Storage = container::initialized_storage>
+struct unordered_map : public container::detail::hash_table<pair<Key, T>, Key, Hash, KeyEqual, N, Storage> {
+    using base = container::detail::hash_table<pair<Key, T>, Key, Hash, KeyEqual, N, Storage>;
+    using key_type = Key;
+    using mapped_type = T;
+    using value_type = pair<Key, T>;
+    using hasher = Hash;
+    using key_equal = KeyEqual;
+    using iterator = typename base::iterator;
+    using const_iterator = typename base::const_iterator;
+
+    unordered_map()
+    : base() {}
+    unordered_map(std::initializer_list<value_type> lst)
+    : base() {
+        for (auto it = lst.begin(); it != lst.end(); ++it)
+            insert(*it);
+    }
+
+    // copy
+    unordered_map(const unordered_map& r)
+    : base(r) {}
+
+    unordered_map& operator=(const unordered_map& r) {
+        base::operator=(r);
+        return *this;
+    }
+
+    // move
+    unordered_map(unordered_map&& r)
+    : base(container::detail::move(r)) {}
+
+    unordered_map& operator=(unordered_map&& r) {
+        base::operator=(container::detail::move(r));
+        return *this;
+    }
+
+    pair<iterator, bool> insert(const Key& key, const T& t) {
+        return try_emplace(key, t);
+    }
+
+    pair<iterator, bool> insert(const value_type& p) {
+        return try_emplace(p.first, p.second);
+    }
+
+    pair<iterator, bool> insert(value_type&& p) {
+        return try_emplace(container::detail::move(p.first), container::detail::move(p.second));
+    }
+
+    pair<iterator, bool> emplace(const Key& key, const T& t) {
+        return insert(key, t);
+    }
+
+    pair<iterator, bool> emplace(const value_type& p) {
+        return insert(p);
+    }
+
+    pair<iterator, bool> emplace(value_type&& p) {
+        return insert(container::detail::move(p));
+    }
+
+    // construct the mapped value in its slot only if the key does not exist
+    // if the map is full, {end(), false} is returned
+    template <class... Args>
+    pair<iterator, bool> try_emplace(const Key& key, Args&&... args) {
+        bool found;
+        const size_t i = this->insert_slot(key, found);
+        if (found) return {this->make_iterator(i), false};
+        if (i == base::slots) return {this->end(), false};
+        return {this->make_iterator(this->construct_at(i, container::detail::in_place_key_t(), key, container::detail::forward<Args>(args)...)), true};
+    }
+
+    template <class... Args>
+    pair<iterator, bool> try_emplace(Key&& key, Args&&... args) {
+        bool found;
+        const size_t i = this->insert_slot(key, found);
+        if (found) return {this->make_iterator(i), false};
+        if (i == base::slots) return {this->end(), false};
+        return {this->make_iterator(this->construct_at(i, container::detail::in_place_key_t(), container::detail::move(key), container::detail::forward<Args>(args)...)), true};
+    }
+
+    // assign to the mapped value if the key exists, otherwise insert it (with a single lookup)
+    template <class M>
+    pair<iterator, bool> insert_or_assign(const Key& key, M&& obj) {
+        bool found;
+        const size_t i = this->insert_slot(key, found);
+        if (found) {
+            this->buffer()[i].second = container::detail::forward<M>(obj);
+            return {this->make_iterator(i), false};
+        }
+        if (i == base::slots) return {this->end(), false};
+        return {this->make_iterator(this->construct_at(i, container::detail::in_place_key_t(), key, container::detail::forward<M>(obj))), true};
+    }
+
+private:
+    T& empty_value() const {
+        static T val;
+        val = T(); // fresh empty value every time
+        return val;
+    }
+
+public:
+    const T& at(const Key& key) const {
+        const_iterator it = this->find(key);
+        if (it != this->end()) return it->second;
+        return empty_value();
+    }
+
+    T& at(const Key& key) {
+        iterator it = this->find(key);
+        if (it != this->end()) return it->second;
+        return empty_value();
+    }
+
+    // if the key can't be added because the map is full, a fresh empty value is returned
+    T& operator[](const Key& key) {
+        iterator it = try_emplace(key).first;
+        if (it == this->end()) return empty_value();
+        return it->second;
+    }
+};
+
+// hash set with a fixed capacity N
+// if it's full, a new key is not inserted (insert() returns {end(), false})
+template <class Key, size_t N = ARX_UNORDERED_SET_DEFAULT_SIZE,
+          class Hash = container::hash<Key>,
+          class KeyEqual = container::key_equal<Key>,
+          typename Storage = container::initialized_storage>
+struct unordered_set : public container::detail::hash_table<Key, Key, Hash, KeyEqual, N, Storage> {
+    using base = container::detail::hash_table<Key, Key, Hash, KeyEqual, N, Storage>;
+    using key_type = Key;
+    using value_type = Key;
+    using hasher = Hash;
+    using key_equal = KeyEqual;
+    // elements can't be modified through iterators (it would break the table)
+    using iterator = typename base::const_iterator;
+    using const_iterator = typename base::const_iterator;
+
+    unordered_set()
+    : base() {}
+    unordered_set(std::initializer_list<Key> lst)
+    : base() {
+        for (auto it = lst.begin(); it != lst.end(); ++it)
+            insert(*it);
+    }
+
+    // copy
+    unordered_set(const unordered_set& r)
+    : base(r) {}
+
+    unordered_set& operator=(const unordered_set& r) {
+        base::operator=(r);
+        return *this;
+    }
+
+    // move
+    unordered_set(unordered_set&& r)
+    : base(container::detail::move(r)) {}
+
+    unordered_set& operator=(unordered_set&& r) {
+        base::operator=(container::detail::move(r));
+        return *this;
+    }
+
+    const_iterator begin() const { return base::begin(); }
+    const_iterator end() const { return base::end(); }
+
+    const_iterator find(const Key& key) const { return base::find(key); }
+
+    pair<iterator, bool> insert(const Key& key) {
+        return emplace_key(key);
+    }
+
+    pair<iterator, bool> insert(Key&& key) {
+        return emplace_key(container::detail::move(key));
+    }
+
+    template <class... Args>
+    pair<iterator, bool> emplace(Args&&... args) {
+        return emplace_key(Key(container::detail::forward<Args>(args)...));
+    }
+
+private:
+    template <class K>
+    pair<iterator, bool> emplace_key(K&& key) {
+        bool found;
+        const size_t i = this->insert_slot(key, found);
+        if (found) return {this->make_iterator(i), false};
+        if (i == base::slots) return {end(), false};
+        return {this->make_iterator(this->construct_at(i, container::detail::forward<K>(key))), true};
+    }
+};
+
+}  // namespace stdx
+}  // namespace arx
+
+#endif  // ARX_CONTAINER_UNORDERED_H
@@ -0,0 +1,229 @@
+#pragma once
+
+#ifndef ARX_CONTAINER_WINDOWED_RING_H
+#define ARX_CONTAINER_WINDOWED_RING_H
+
+// included from ArxContainer.h
+
+namespace arx {
+
+namespace container {
+    namespace detail {
+        // accumulator of windowed_ring: exact for integers (as long as the sum of squares fits),
+        // the sample type itself for floating point
+        template <typename T>
+        struct window_accumulator {
+            using type = int64_t;
+        };
+        template <>
+        struct window_accumulator<float> {
+            using type = float;
+        };
+        template <>
+        struct window_accumulator<double> {
+            using type = double;
+        };
+        template <>
+        struct window_accumulator<long double> {
+            using type = long double;
+        };
+
+        // variance of integer samples: n * sum_sq - sum * sum is exact in Acc and is divided only once
+        template <typename Acc>
+        struct window_moments {
+            void reset() {}
+            void add(const Acc&, const size_t) {}
+            void remove(const Acc&, const size_t) {}
+            double variance(const Acc& sum, const Acc& sum_sq, const size_t n) const {
+                const Acc d = static_cast<Acc>(n) * sum_sq - sum * sum;
+                return static_cast<double>(d) / (static_cast<double>(n) * static_cast<double>(n));
+            }
+        };
+
+        // variance of floating point samples: the mean and the sum of squared deviations (M2)
+        // are updated by Welford's method, which doesn't cancel as sum_sq / n - mean * mean does
+        template <typename F>
+        struct welford_moments {
+            F mean_ {0};
+            F m2_ {0};
+
+            void reset() { mean_ = m2_ = F(0); }
+            // n is the number of samples after adding x
+            void add(const F& x, const size_t n) {
+                const F d = x - mean_;
+                mean_ += d / static_cast<F>(n);
+                m2_ += d * (x - mean_);
+            }
+            // n is the number of samples after removing x
+            void remove(const F& x, const size_t n) {
+                if (n == 0) {
+                    reset();
+                    return;
+                }
+                const F d = x - mean_;
+                mean_ -= d / static_cast<F>(n);
+                m2_ -= d * (x - mean_);
+                if (m2_ < F(0)) m2_ = F(0);
+            }
+            double variance(const F&, const F&, const size_t n) const {
+                return static_cast<double>(m2_) / static_cast<double>(n);
+            }
+        };
+        template <>
+        struct window_moments<float> : welford_moments<float> {};
+        template <>
+        struct window_moments<double> : welford_moments<double> {};
+        template <>
+        struct window_moments<long double> : welford_moments<long double> {};
+
+        // candidate for the min/max of a window: the sample and its position in the ring (mod N)
+        template <typename T, typename Index>
+        struct window_entry {
+            T value;
+            Index pos;
+        };
+    }  // namespace detail
+}  // namespace container
+
+// sliding window over the last N samples with O(1) statistics:
+// the sum and the sum of squares are updated on push/pop, and min/max are the fronts of monotonic deques
+// (each sample enters and leaves them at most once, so push is O(1) amortized).
+//   arx::windowed_ring<int16_t, 32> w;
+//   w.push(analogRead(A0));
+//   w.mean(); w.variance(); w.min(); w.max();
+// if it's full, push() drops the oldest sample as RingBuffer does (or is rejected by the Overflow policy).
+// Acc is the type of sum() and sum_of_squares(): choose a narrower one (e.g. int32_t) for speed on AVR if it can't overflow.
+// variance() of integer samples is exact up to the final division, but Acc must hold N * sum_of_squares()
+// (N * N * max(|sample|)^2: int64_t is enough for int16_t samples if N <= 65535, int32_t for 10-bit ADC values if N <= 32).
+// variance() of floating point samples is updated by Welford's method, so it keeps the precision of Acc
+// relative to the spread of the samples, not to their magnitude.
+// with floating point samples, the running sums accumulate rounding errors over a long uptime (call recalculate()).
+template <typename T, size_t N,
+          typename Acc = typename container::detail::window_accumulator<T>::type,
+          typename Overflow = container::overflow::overwrite>
+class windowed_ring : container::detail::window_moments<Acc> {
+    using moments = container::detail::window_moments<Acc>;
+
+    using index_type = typename container::detail::least_uint<N>::type;
+    using wrap = container::detail::index_wrap<N>;
+    using entry = container::detail::window_entry<T, index_type>;
+
+    RingBuffer<T, N, container::initialized_storage, Overflow> samples_;
+    // values increase from front to back (min_.front() is the minimum)
+    RingBuffer<entry, N> min_;
+    // values decrease from front to back (max_.front() is the maximum)
+    RingBuffer<entry, N> max_;
+    Acc sum_;
+    Acc sum_sq_;
+    index_type next_;  // position (mod N) of the next sample
+
+public:
+    using value_type = T;
+    using samples_type = RingBuffer<T, N, container::initialized_storage, Overflow>;
+
+    windowed_ring()
+    : sum_(0), sum_sq_(0), next_(0) {}
+
+    size_t size() const { return samples_.size(); }
+    size_t capacity() const { return N; }
+    bool empty() const { return samples_.empty(); }
+    bool full() const { return samples_.size() == N; }
+
+    // samples from the oldest to the newest
+    const T& operator[](const size_t i) const { return samples_[i]; }
+    const T& front() const { return samples_.front(); }
+    const T& back() const { return samples_.back(); }
+    const samples_type& samples() const { return samples_; }
+
+    // number of samples lost by overflow (always 0 if the policy doesn't count)
+    uint32_t dropped() const { return samples_.dropped(); }
+    void reset_dropped() { samples_.reset_dropped(); }
+
+    container::push_result push(const T& v) {
+        if (full() && !Overflow::rejects_new) retire();
+        const container::push_result r = samples_.push_back(v);
+        if (r != container::push_result::rejected) admit(v);
+        return r;
+    }
+
+    // drop the oldest sample
+    void pop() {
+        if (empty()) return;
+        retire();
+        samples_.pop_front();
+    }
+
+    void clear() {
+        samples_.clear();
+        min_.clear();
+        max_.clear();
+        sum_ = sum_sq_ = Acc(0);
+        next_ = 0;
+        moments::reset();
+    }
+
+    Acc sum() const { return sum_; }
+    Acc sum_of_squares() const { return sum_sq_; }
+
+    // T() if empty
+    T min() const { return min_.empty() ? T() : min_.front().value; }
+    T max() const { return max_.empty() ? T() : max_.front().value; }
+
+    // 0 if empty
+    double mean() const {
+        return empty() ? 0. : static_cast<double>(sum_) / static_cast<double>(size());
+    }
+    // population variance (divided by size())
+    double variance() const {
+        if (empty()) return 0.;
+        return moments::variance(sum_, sum_sq_, size());
+    }
+
+    // recompute the sums from the samples in O(N) (discards rounding errors of floating point sums)
+    void recalculate() {
+        sum_ = sum_sq_ = Acc(0);
+        moments::reset();
+        for (size_t i = 0; i < size(); ++i) {
+            const Acc a = static_cast<Acc>(samples_[i]);
+            sum_ += a;
+            sum_sq_ += a * a;
+            moments::add(a, i + 1);
+        }
+    }
+
+private:
+    // the newest sample has been stored at next_
+    void admit(const T& v) {
+        const Acc a = static_cast<Acc>(v);
+        sum_ += a;
+        sum_sq_ += a * a;
+        moments::add(a, size());
+        while (!min_.empty() && !(min_.back().value < v)) min_.pop_back();
+        while (!max_.empty() && !(v < max_.back().value)) max_.pop_back();
+        min_.push_back(entry {v, next_});
+        max_.push_back(entry {v, next_});
+        next_ = wrap::next(next_);
+    }
+
+    // the oldest sample is about to be removed.
+    // all the entries in min_/max_ are in the window of at most N samples, so their positions mod N are unique
+    void retire() {
+        const T& v = samples_.front();
+        const Acc a = static_cast<Acc>(v);
+        sum_ -= a;
+        sum_sq_ -= a * a;
+        moments::remove(a, size() - 1);
+        const index_type pos = static_cast<index_type>(wrap::wrap(static_cast<int>(next_) - static_cast<int>(size())));
+        if (!min_.empty() && min_.front().pos == pos) min_.pop_front();
+        if (!max_.empty() && max_.front().pos == pos) max_.pop_front();
+    }
+};
+
+}  // namespace arx
+
+template <typename T, size_t N,
+          typename Acc = typename arx::container::detail::window_accumulator<T>::type,
+          typename Overflow = arx::container::overflow::overwrite>
+using ArxWindowedRing = arx::windowed_ring<T, N, Acc, Overflow>;
+
+#endif  // ARX_CONTAINER_WINDOWED_RING_H
@@ -0,0 +1,118 @@
+#include <ArxContainer.h>
+
+// Measures the cost of element access on RingBuffer.
+// Index wrapping is done with a mask when N is a power of two,
+// and with an add/sub (no division) for other sizes.
+// ModuloRing wraps with % N as RingBuffer did before, for comparison on the same board.
+
+static const uint16_t ITERATIONS = 2000;
+
+ArxRingBuffer<uint8_t, 16> buffer_pow2;  // mask based wrapping
+ArxRingBuffer<uint8_t, 15> buffer_npow2; // branch based wrapping
+uint8_t plain[16];                       // reference: raw array access
+
+// reference: the wrapping used before (int positions, % N on every access)
+template <typename T, int N>
+struct ModuloRing {
+    T queue[N];
+    int head {0};
+    int tail {0};
+
+    static int wrap(const int pos) {
+        if (pos >= 0)
+            return pos % N;
+        else
+            return (N - 1) - (abs(pos + 1) % N);
+    }
+
+    size_t capacity() const { return N; }
+    void clear() { head = tail = 0; }
+    void push_back(const T& v) {
+        queue[wrap(tail++)] = v;
+        if (tail - head > N) ++head;
+    }
+    void pop_front() { ++head; }
+    const T& front() const { return queue[wrap(head)]; }
+    const T& operator[](const size_t i) const { return queue[wrap(head + static_cast<int>(i))]; }
+};
+
+ModuloRing<uint8_t, 16> modulo_pow2;
+ModuloRing<uint8_t, 15> modulo_npow2;
+
+volatile uint8_t sink = 0;
+
+float cycles_per_op(const uint32_t us, const uint32_t ops) {
+    return (float)us * (float)(F_CPU / 1000000UL) / (float)ops;
+}
+
+template <typename Buffer>
+void fill(Buffer& b) {
+    b.clear();
+    // push more than capacity so that head is not at index 0
+    for (size_t i = 0; i < b.capacity() + b.capacity() / 2; ++i)
+        b.push_back((uint8_t)i);
+}
+
+uint32_t bench_plain() {
+    uint32_t start = micros();
+    for (uint16_t n = 0; n < ITERATIONS; ++n)
+        for (size_t i = 0; i < 15; ++i)
+            sink += plain[i];
+    return micros() - start;
+}
+
+template <typename Buffer>
+uint32_t bench_index(Buffer& b) {
+    uint32_t start = micros();
+    for (uint16_t n = 0; n < ITERATIONS; ++n)
+        for (size_t i = 0; i < 15; ++i)
+            sink += b[i];
+    return micros() - start;
+}
+
+template <typename Buffer>
+uint32_t bench_push_pop(Buffer& b) {
+    uint32_t start = micros();
+    for (uint16_t n = 0; n < ITERATIONS; ++n) {
+        b.push_back((uint8_t)n);
+        sink += b.front();
+        b.pop_front();
+    }
+    return micros() - start;
+}
+
+template <typename Buffer>
+void report(const char* name, Buffer& b, const uint32_t overhead) {
+    fill(b);
+    const uint32_t ops = (uint32_t)ITERATIONS * 15;
+    uint32_t us = bench_index(b);
+    Serial.print(name);
+    Serial.print(" operator[] : ");
+    Serial.print(cycles_per_op(us > overhead ? us - overhead : 0, ops));
+    Serial.println(" cycles/access");
+
+    fill(b);
+    us = bench_push_pop(b);
+    Serial.print(name);
+    Serial.print(" push/front/pop : ");
+    Serial.print(cycles_per_op(us, ITERATIONS));
+    Serial.println(" cycles/iteration");
+}
+
+void setup() {
+    Serial.begin(115200);
+    delay(2000);
+
+    const uint32_t overhead = bench_plain();
+    Serial.print("raw array loop : ");
+    Serial.print(cycles_per_op(overhead, (uint32_t)ITERATIONS * 15));
+    Serial.println(" cycles/access (subtracted below)");
+
+    report("N = 16 (mask)", buffer_pow2, overhead);
+    report("N = 16 (% N, before)", modulo_pow2, overhead);
+    report("N = 15 (add/sub)", buffer_npow2, overhead);
+    report("N = 15 (% N, before)", modulo_npow2, overhead);
+}
+
+void loop() {
+}
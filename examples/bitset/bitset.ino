@@ -0,0 +1,36 @@
+#include <ArxContainer.h>
+
+// 1 bit per flag: 8 bytes for 64 channels (std::bitset if available)
+std::bitset<64> active;
+// packed vector of up to 128 flags
+arx::stdx::vector<bool, 128> history;
+
+void setup() {
+    Serial.begin(115200);
+    delay(2000);
+
+    active.set(3);
+    active.set(17);
+    active[40] = true;
+
+    Serial.print("active channels: ");
+    Serial.println(active.count());
+
+    // visit set bits only, a word at a time
+    arx::stdx::bitset<64> a;
+    a.set(3).set(17).set(40);
+    for (size_t i = a.find_first(); i < a.size(); i = a.find_next(i)) {
+        Serial.print(i);
+        Serial.print(" ");
+    }
+    Serial.println();
+}
+
+void loop() {
+    // the oldest flag is dropped when full
+    history.push_back(digitalRead(2) == HIGH);
+
+    Serial.print("high ratio = ");
+    Serial.println((float)history.count() / history.size());
+    delay(100);
+}
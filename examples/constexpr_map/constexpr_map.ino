@@ -0,0 +1,42 @@
+#include <ArxContainer.h>
+
+// evaluated at compile time: no SRAM and no code at runtime
+constexpr arx::stdx::array<uint8_t, 4> gamma_table {{0, 16, 64, 255}};
+static_assert(gamma_table[3] == 255, "");
+
+// sorted key/value table
+constexpr arx::stdx::constexpr_map<uint8_t, uint16_t, 4> baud_table {{{1, 96}, {2, 192}, {3, 384}, {7, 1152}}};
+static_assert(baud_table.is_sorted(), "keys must be sorted");
+static_assert(baud_table.at(7) == 1152, "");
+
+// tables in flash: they are not copied into SRAM at startup
+const uint16_t sine_P[8] PROGMEM = {500, 853, 1000, 853, 500, 146, 0, 146};
+const arx::stdx::constexpr_map<uint8_t, uint16_t, 4> baud_P PROGMEM {{{1, 96}, {2, 192}, {3, 384}, {7, 1152}}};
+
+void setup() {
+    Serial.begin(115200);
+    delay(2000);
+
+    // only a pointer is kept in SRAM, and elements are read from flash
+    auto sine = arx::stdx::make_progmem(sine_P);
+    for (const auto v : sine) {
+        Serial.print(v);
+        Serial.print(" ");
+    }
+    Serial.println();
+
+    // binary search in flash
+    auto baud = arx::stdx::make_progmem(baud_P);
+    uint8_t id = 3;
+    Serial.print("baud of 3 = ");
+    Serial.println(baud.at(id) * 100UL);
+    Serial.print("has 5 = ");
+    Serial.println(baud.contains(5));
+
+    // runtime lookup of the constexpr table
+    Serial.print("baud of 2 = ");
+    Serial.println(baud_table.at(id - 1) * 100UL);
+}
+
+void loop() {
+}
@@ -0,0 +1,41 @@
+#include <ArxContainer.h>
+
+// up to 15 characters inline: no heap allocation for keys
+using Key = arx::stdx::fixed_string<15>;
+
+arx::stdx::map<Key, int> config {{"baud", 115200}, {"retry", 3}};
+// hash is computed once on modification instead of on every lookup
+arx::stdx::unordered_map<arx::stdx::fixed_string<15, true>, int> counters;
+
+void setup() {
+    Serial.begin(115200);
+    delay(2000);
+
+    config["timeout"] = 100;
+
+    Key k("retry");
+    Serial.print("retry = ");
+    Serial.println(config[k]);
+
+    // build a key without String
+    Key name("ch");
+    name += '0' + 2;
+    name += "_gain";
+    Serial.print(name.c_str());
+    Serial.print(" (");
+    Serial.print(name.size());
+    Serial.println(")");
+
+    counters["rx"] = 0;
+    counters["tx"] = 0;
+    ++counters["rx"];
+
+    for (const auto& c : counters) {
+        Serial.print(c.first.c_str());
+        Serial.print(" = ");
+        Serial.println(c.second);
+    }
+}
+
+void loop() {
+}
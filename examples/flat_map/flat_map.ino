@@ -0,0 +1,42 @@
+#include <ArxContainer.h>
+
+// keys are kept sorted, so lookups are binary searches
+arx::stdx::flat_map<String, int, 8> mp {{"two", 2}, {"one", 1}, {"four", 4}};
+
+void setup() {
+    Serial.begin(115200);
+    delay(2000);
+
+    // add contents
+    mp.insert("three", 3);
+    mp["five"] = 5;
+    mp.insert_or_assign("one", 11);
+
+    // range based access (ordered by key)
+    Serial.print({"{ "});
+    for (const auto& m : mp) {
+        Serial.print("{");
+        Serial.print(m.first);
+        Serial.print(",");
+        Serial.print(m.second);
+        Serial.print("},");
+    }
+    Serial.println({" }"});
+
+    // key access
+    auto it = mp.find("three");
+    if (it != mp.end()) {
+        Serial.print("three = ");
+        Serial.println(it->second);
+    }
+    Serial.print("one   = ");
+    Serial.println(mp["one"]);
+
+    // erase by key
+    mp.erase("two");
+    Serial.print("size  = ");
+    Serial.println(mp.size());
+}
+
+void loop() {
+}
@@ -0,0 +1,58 @@
+#include <ArxContainer.h>
+
+struct Packet {
+    uint8_t id;
+    uint8_t payload[32];
+};
+
+// initialize with initializer_list
+std::list<int> lst {1, 2, 3};
+// this is same as
+// arx::stdx::list<int> lst {1, 2, 3};
+
+// up to 8 packets in a static pool, links are uint8_t
+arx::stdx::list<Packet, 8> pending;
+arx::stdx::list<Packet, 8> retry;
+
+void setup() {
+    Serial.begin(115200);
+    delay(2000);
+
+    lst.push_front(0);
+    lst.push_back(4);
+    auto it = lst.begin();
+    ++it;
+    lst.insert(it, 10); // 0, 10, 1, 2, 3, 4
+    lst.remove(2);      // 0, 10, 1, 3, 4
+    for (const auto& v : lst) {
+        Serial.print(v);
+        Serial.print(" ");
+    }
+    Serial.println();
+
+    for (uint8_t i = 0; i < 4; ++i) {
+        Packet p {};
+        p.id = i;
+        pending.push_back(p);
+    }
+
+    // move the second packet to the end without copying the others
+    auto second = pending.begin();
+    ++second;
+    pending.splice(pending.end(), pending, second);
+
+    // move the front packet to another list
+    retry.splice(retry.end(), pending, pending.begin());
+
+    Serial.print("pending = ");
+    for (const auto& p : pending) {
+        Serial.print(p.id);
+        Serial.print(" ");
+    }
+    Serial.println();
+    Serial.print("retry = ");
+    Serial.println(retry.front().id);
+}
+
+void loop() {
+}
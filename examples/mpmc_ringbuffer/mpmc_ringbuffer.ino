@@ -0,0 +1,45 @@
+#include <ArxContainer.h>
+
+// MpmcRingBuffer can be shared by any number of producers and consumers without a mutex:
+// e.g. several RTOS tasks on ESP32 / RP2040, or several ISRs and loop() on AVR.
+// Here two ISRs are the producers and loop() is the consumer.
+// N must be a power of two. If the queue is full, push() fails instead of overwriting.
+
+static const uint8_t PIN_A = 2;
+static const uint8_t PIN_B = 3;
+
+struct Event {
+    uint8_t pin;
+    unsigned long us;
+};
+
+ArxMpmcRingBuffer<Event, 16> events;
+
+void on_a() {
+    events.push(Event {PIN_A, micros()});
+}
+
+void on_b() {
+    events.push(Event {PIN_B, micros()});
+}
+
+void setup() {
+    Serial.begin(115200);
+    delay(2000);
+
+    pinMode(PIN_A, INPUT_PULLUP);
+    pinMode(PIN_B, INPUT_PULLUP);
+    attachInterrupt(digitalPinToInterrupt(PIN_A), on_a, CHANGE);
+    attachInterrupt(digitalPinToInterrupt(PIN_B), on_b, CHANGE);
+}
+
+void loop() {
+    Event e;
+    while (events.pop(e)) {
+        Serial.print("pin ");
+        Serial.print(e.pin);
+        Serial.print(" at ");
+        Serial.print(e.us);
+        Serial.println(" us");
+    }
+}
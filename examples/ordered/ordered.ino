@@ -0,0 +1,51 @@
+#include <ArxContainer.h>
+
+// set / multiset / multimap keep their elements sorted in a fixed-capacity array:
+// find() and lower_bound() / upper_bound() / equal_range() are binary searches,
+// and iteration is in key order (equal keys in insertion order).
+
+// event id by timestamp [ms] (several events can have the same timestamp)
+std::multimap<uint32_t, uint8_t> events;
+// ids which have ever been seen
+std::set<uint8_t> seen;
+
+void setup() {
+    Serial.begin(115200);
+    delay(2000);
+
+    events.emplace(1200, 3);
+    events.emplace(500, 1);
+    events.emplace(1200, 4);
+    events.emplace(800, 2);
+    events.emplace(2500, 5);
+    for (const auto& e : events) seen.insert(e.second);
+
+    // events in [600, 2000) ms
+    Serial.println("events in [600, 2000):");
+    auto last = events.lower_bound(2000);
+    for (auto it = events.lower_bound(600); it != last; ++it) {
+        Serial.print(it->first);
+        Serial.print(" ms : id ");
+        Serial.println(it->second);
+    }
+
+    // all events at 1200 ms
+    auto range = events.equal_range(1200);
+    for (auto it = range.first; it != range.second; ++it) {
+        Serial.print("at 1200 ms : id ");
+        Serial.println(it->second);
+    }
+
+    Serial.print("events at 1200 ms : ");
+    Serial.println(events.count(1200));
+    Serial.print("id 4 seen : ");
+    Serial.println(seen.count(4) ? "yes" : "no");
+
+    // drop the events before 1000 ms
+    events.erase(events.begin(), events.lower_bound(1000));
+    Serial.print("remaining events : ");
+    Serial.println(events.size());
+}
+
+void loop() {
+}
@@ -0,0 +1,52 @@
+#include <ArxContainer.h>
+
+struct Timer {
+    uint32_t deadline;
+    uint8_t id;
+};
+
+// the nearest deadline comes first
+struct Later {
+    bool operator()(const Timer& a, const Timer& b) const {
+        return a.deadline > b.deadline;
+    }
+};
+
+arx::stdx::priority_queue<Timer, 8, Later> timers;
+arx::stdx::priority_queue<int> pq {3, 1, 4, 1, 5};
+
+void setup() {
+    Serial.begin(115200);
+    delay(2000);
+
+    // largest first
+    Serial.print("pq = ");
+    while (!pq.empty()) {
+        Serial.print(pq.top());
+        Serial.print(" ");
+        pq.pop();
+    }
+    Serial.println();
+
+    const uint32_t now = millis();
+    timers.push({now + 1000, 1});
+    timers.push({now + 200, 2});
+    timers.push({now + 500, 3});
+
+    // heap algorithms on any random access range
+    arx::stdx::vector<int, 8> v {2, 7, 1};
+    arx::stdx::make_heap(v.begin(), v.end());
+    v.push_back(9);
+    arx::stdx::push_heap(v.begin(), v.end());
+    Serial.print("max = ");
+    Serial.println(v.front());
+}
+
+void loop() {
+    // O(log N) instead of scanning all timers
+    while (!timers.empty() && (int32_t)(millis() - timers.top().deadline) >= 0) {
+        Serial.print("fire timer ");
+        Serial.println(timers.top().id);
+        timers.pop();
+    }
+}
@@ -0,0 +1,54 @@
+#include <ArxContainer.h>
+
+// views don't depend on the capacity, so these functions are compiled only once
+uint16_t checksum(arx::stdx::ring_span<const uint8_t> data) {
+    uint16_t sum = 0;
+    for (const auto& b : data) sum += b;
+    return sum;
+}
+
+void print_all(arx::stdx::span<const uint8_t> data) {
+    for (const auto& b : data) {
+        Serial.print(b);
+        Serial.print(" ");
+    }
+    Serial.println();
+}
+
+arx::stdx::deque<uint8_t, 8> rx;
+arx::stdx::vector<uint8_t, 16> tx {1, 2, 3, 4};
+uint8_t raw[3] {5, 6, 7};
+
+void setup() {
+    Serial.begin(115200);
+    delay(2000);
+
+    // wrap around the storage
+    for (uint8_t i = 0; i < 12; ++i) rx.push_back(i);
+
+    Serial.print("rx sum  = ");
+    Serial.println(checksum(rx));
+    Serial.print("tx sum  = ");
+    Serial.println(checksum(tx));
+    Serial.print("raw sum = ");
+    Serial.println(checksum(raw));
+
+    // skip the first 2 bytes without copying
+    arx::stdx::ring_span<const uint8_t> body = arx::stdx::ring_span<const uint8_t>(rx).subspan(2);
+    Serial.print("body sum = ");
+    Serial.println(checksum(body));
+
+    print_all(tx);
+    print_all(arx::stdx::span<const uint8_t>(tx).subspan(1, 2));
+
+    // parse "key=value" without copying
+    arx::stdx::string_view line("baud=115200");
+    const size_t eq = line.find('=');
+    if (eq != arx::stdx::string_view::npos && line.substr(0, eq) == "baud") {
+        Serial.print("baud = ");
+        Serial.println(atol(line.substr(eq + 1).data()));
+    }
+}
+
+void loop() {
+}
@@ -0,0 +1,54 @@
+#include <ArxContainer.h>
+
+// SpscRingBuffer can be shared by one producer and one consumer without disabling interrupts.
+// Here the ISR is the producer and loop() is the consumer.
+// If the buffer is full, push() fails instead of overwriting the data not read yet.
+
+static const uint8_t PIN_INPUT = 2;
+
+ArxSpscRingBuffer<uint32_t, 16> edges;
+volatile uint16_t dropped = 0;
+
+void on_edge() {
+    if (!edges.push(micros()))
+        ++dropped;
+}
+
+void setup() {
+    Serial.begin(115200);
+    delay(2000);
+
+    pinMode(PIN_INPUT, INPUT_PULLUP);
+    attachInterrupt(digitalPinToInterrupt(PIN_INPUT), on_edge, CHANGE);
+}
+
+void loop() {
+    // pop in bulk
+    uint32_t stamps[8];
+    const size_t n = edges.pop(stamps, 8);
+    for (size_t i = 0; i < n; ++i) {
+        Serial.print("edge at ");
+        Serial.print(stamps[i]);
+        Serial.println(" us");
+    }
+
+    // or one by one
+    uint32_t stamp;
+    while (edges.pop(stamp)) {
+        Serial.print("edge at ");
+        Serial.print(stamp);
+        Serial.println(" us");
+    }
+
+    // dropped is written by the ISR and wider than a byte
+    static uint16_t reported = 0;
+    noInterrupts();
+    const uint16_t n_dropped = dropped;
+    interrupts();
+    if (n_dropped != reported) {
+        Serial.print("dropped: ");
+        Serial.println(n_dropped);
+        reported = n_dropped;
+    }
+    delay(100);
+}
@@ -0,0 +1,58 @@
+#include <ArxContainer.h>
+
+// initialize with initializer_list
+// (std::hash<String> is not defined, so use arx::stdx version even if std::unordered_map is available)
+arx::stdx::unordered_map<String, int> mp {{"one", 1}, {"two", 2}, {"four", 4}};
+
+// message id -> handler index
+std::unordered_map<uint16_t, uint8_t> routes;
+// this is same as
+// arx::stdx::unordered_map<uint16_t, uint8_t> routes;
+std::unordered_set<uint16_t> seen;
+
+void setup() {
+    Serial.begin(115200);
+    delay(2000);
+
+    // add contents
+    mp.insert(arx::stdx::make_pair(String("three"), 3));
+    mp["five"] = 5;
+
+    // range based access (not ordered)
+    Serial.print({"{ "});
+    for (const auto& m : mp) {
+        Serial.print("{");
+        Serial.print(m.first);
+        Serial.print(",");
+        Serial.print(m.second);
+        Serial.print("},");
+    }
+    Serial.println({" }"});
+
+    // key access
+    Serial.print("one   = ");
+    Serial.println(mp["one"]);
+    Serial.print("three = ");
+    Serial.println(mp["three"]);
+
+    for (uint16_t id = 0x100; id < 0x110; ++id)
+        routes[id] = id & 0x0F;
+
+    auto it = routes.find(0x105);
+    if (it != routes.end()) {
+        Serial.print("route of 0x105 = ");
+        Serial.println(it->second);
+    }
+    routes.erase(0x105);
+    Serial.print("routes = ");
+    Serial.println(routes.size());
+
+    seen.insert(1);
+    seen.insert(2);
+    seen.insert(1);
+    Serial.print("seen = ");
+    Serial.println(seen.size());
+}
+
+void loop() {
+}
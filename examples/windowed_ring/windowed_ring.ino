@@ -0,0 +1,25 @@
+#include <ArxContainer.h>
+
+// the last 32 samples (int32_t sums can't overflow: 32 * 1023 * 1023 < 2^31)
+arx::windowed_ring<int16_t, 32, int32_t> window;
+
+void setup() {
+    Serial.begin(115200);
+    delay(2000);
+}
+
+void loop() {
+    // the oldest sample is dropped when full, and all statistics are updated in O(1)
+    window.push(analogRead(A0));
+
+    Serial.print("mean = ");
+    Serial.print(window.mean());
+    Serial.print(", stddev = ");
+    Serial.print(sqrt(window.variance()));
+    Serial.print(", min = ");
+    Serial.print(window.min());
+    Serial.print(", max = ");
+    Serial.println(window.max());
+
+    delay(100);
+}
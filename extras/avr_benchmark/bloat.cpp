@@ -0,0 +1,63 @@
+// flash cost of using one more capacity N of the same container and element type
+// build with -DARX_BLOAT_INSTANCES=1..5 and compare .text (make bloat.csv)
+//   ARX_BLOAT_KIND=0 : arx::stdx::vector<uint8_t, N>
+//   ARX_BLOAT_KIND=1 : arx::RingBuffer<uint8_t, N>
+// N is 8, 16, 32, 64, 128 in this order
+
+#include <stddef.h>  // size_t (included by Arduino.h in sketches)
+
+#include <ArxContainer.h>
+
+#ifndef ARX_BLOAT_INSTANCES
+#define ARX_BLOAT_INSTANCES 5
+#endif
+
+#ifndef ARX_BLOAT_KIND
+#define ARX_BLOAT_KIND 0
+#endif
+
+// inputs and results are volatile so that nothing is constant folded
+volatile uint8_t source;
+volatile uint16_t sink;
+
+template <class C>
+__attribute__((noinline)) void exercise(C& c) {
+    const uint8_t v = source;
+    for (uint8_t i = 0; i < 4; ++i) c.push_back(v);
+    c.insert(c.begin() + 1, v);
+    c.insert(c.end() - 1, v);
+    c.erase(c.begin() + 2);
+    c.erase(c.begin(), c.begin() + 2);
+    c.resize(c.size() + v);
+    uint16_t s = 0;
+    for (size_t i = 0; i < c.size(); ++i) s += c[i];
+    c.pop_back();
+    sink = s + c.size();
+}
+
+template <size_t N>
+void use() {
+#if ARX_BLOAT_KIND == 0
+    static arx::stdx::vector<uint8_t, N> c;
+#else
+    static arx::RingBuffer<uint8_t, N> c;
+#endif
+    exercise(c);
+}
+
+int main() {
+    use<8>();
+#if ARX_BLOAT_INSTANCES >= 2
+    use<16>();
+#endif
+#if ARX_BLOAT_INSTANCES >= 3
+    use<32>();
+#endif
+#if ARX_BLOAT_INSTANCES >= 4
+    use<64>();
+#endif
+#if ARX_BLOAT_INSTANCES >= 5
+    use<128>();
+#endif
+    return 0;
+}
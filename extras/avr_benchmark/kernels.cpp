@@ -0,0 +1,240 @@
+// benchmark kernels for ATmega328P, run under simavr by simavr_runner
+//
+// each kernel is a noinline function, so its flash size can be read from the symbol table,
+// and every container is a global, so its SRAM footprint (.bss) can be read as well.
+// the runner is told about each kernel through GPIOR registers:
+//   GPIOR2 <- name (chars, terminated by 0), GPIOR1 <- ops (low, high)
+//   GPIOR0 <- MARK_START before and MARK_STOP after the kernel, MARK_DONE at the end
+// and counts the exact cycles between the two marks.
+
+#include <avr/io.h>
+#include <avr/pgmspace.h>
+#include <avr/sleep.h>
+#include <avr/interrupt.h>
+#include <stddef.h>  // size_t (included by Arduino.h in sketches)
+
+#include <ArxContainer.h>
+
+#define MARK_START 1
+#define MARK_STOP 2
+#define MARK_DONE 0xFF
+
+#define NOINLINE __attribute__((noinline))
+#define BARRIER() __asm__ __volatile__("" ::: "memory")
+
+static const uint16_t OPS = 256;
+
+// results are written here so that the kernels are not optimized away
+volatile uint16_t sink;
+
+typedef void (*kernel_t)();
+
+static NOINLINE void run_kernel(const char* name_P, const uint16_t ops, kernel_t kernel) {
+    for (const char* p = name_P;; ++p) {
+        const char c = pgm_read_byte(p);
+        GPIOR2 = c;
+        if (!c) break;
+    }
+    GPIOR1 = ops & 0xFF;
+    GPIOR1 = ops >> 8;
+    BARRIER();
+    GPIOR0 = MARK_START;
+    kernel();
+    GPIOR0 = MARK_STOP;
+    BARRIER();
+}
+
+#define RUN(kernel) run_kernel(PSTR(#kernel), OPS, kernel)
+
+// ---------- containers (one global per instantiation) ----------
+
+arx::RingBuffer<uint8_t, 16> rb_u8_16;
+arx::RingBuffer<uint8_t, 15> rb_u8_15;
+arx::RingBuffer<int16_t, 32> rb_i16_32;
+arx::stdx::deque<uint8_t, 8> dq_u8_8;
+arx::stdx::vector<uint8_t, 16> vec_u8_16;
+arx::stdx::vector<int16_t, 16> vec_i16_16;
+arx::stdx::map<uint8_t, uint8_t, 8> map_u8_8;
+arx::stdx::map<uint8_t, uint8_t, 32> map_u8_32;
+arx::stdx::flat_map<uint8_t, uint8_t, 32> flat_map_u8_32;
+arx::stdx::unordered_map<uint8_t, uint8_t, 32> unordered_map_u8_32;
+
+// sizeof only: not used by the kernels, their .bss size in sizes.csv is the sizeof on AVR
+arx::stdx::deque<int16_t, 16> dq_i16_16;
+arx::RingBuffer<uint8_t, 300> rb_u8_300;
+arx::stdx::deque<uint8_t, 8>::iterator dq_u8_8_it;
+
+// ---------- kernels ----------
+
+// calibration: the cost of the call and the marks, subtracted from every kernel by the runner
+NOINLINE void kernel_empty() {
+}
+
+template <class C>
+static inline void push_pop(C& c) {
+    uint16_t s = 0;
+    for (uint16_t i = 0; i < OPS; ++i) {
+        c.push_back(static_cast<typename C::value_type>(i));
+        s += c.front();
+        c.pop_front();
+    }
+    sink = s;
+}
+
+// sweep the elements until OPS reads
+// (i % c.size() would call the division routine on every read and measure that instead of the index wrap)
+template <class C>
+static inline void index_all(C& c) {
+    uint16_t s = 0;
+    const uint16_t n = c.size();
+    for (uint16_t i = 0; i < OPS; i += n)
+        for (uint16_t j = 0; j < n; ++j) s += c[j];
+    sink = s;
+}
+
+NOINLINE void ring_push_pop_u8_16() { push_pop(rb_u8_16); }
+NOINLINE void ring_push_pop_u8_15() { push_pop(rb_u8_15); }
+NOINLINE void ring_push_pop_i16_32() { push_pop(rb_i16_32); }
+
+NOINLINE void ring_index_u8_16() { index_all(rb_u8_16); }
+NOINLINE void ring_index_u8_15() { index_all(rb_u8_15); }
+
+NOINLINE void deque_push_front_pop_back_u8_8() {
+    uint16_t s = 0;
+    for (uint16_t i = 0; i < OPS; ++i) {
+        dq_u8_8.push_front(static_cast<uint8_t>(i));
+        s += dq_u8_8.back();
+        dq_u8_8.pop_back();
+    }
+    sink = s;
+}
+
+NOINLINE void ring_insert_erase_middle_u8_16() {
+    uint16_t s = 0;
+    for (uint16_t i = 0; i < OPS; ++i) {
+        rb_u8_16.insert(rb_u8_16.begin() + 7, static_cast<uint8_t>(i));
+        s += rb_u8_16[7];
+        rb_u8_16.erase(rb_u8_16.begin() + 7);
+    }
+    sink = s;
+}
+
+NOINLINE void vector_push_back_u8_16() {
+    uint16_t s = 0;
+    for (uint16_t i = 0; i < OPS; ++i) {
+        if (vec_u8_16.size() == vec_u8_16.capacity()) vec_u8_16.clear();
+        vec_u8_16.push_back(static_cast<uint8_t>(i));
+        s += vec_u8_16.size();
+    }
+    sink = s;
+}
+
+template <class C>
+static inline void insert_erase_front(C& c) {
+    uint16_t s = 0;
+    for (uint16_t i = 0; i < OPS; ++i) {
+        c.insert(c.begin(), static_cast<typename C::value_type>(i));
+        s += c[1];
+        c.erase(c.begin());
+    }
+    sink = s;
+}
+
+NOINLINE void vector_insert_erase_front_u8_16() { insert_erase_front(vec_u8_16); }
+NOINLINE void vector_insert_erase_front_i16_16() { insert_erase_front(vec_i16_16); }
+
+template <class C>
+static inline void find_hit(C& c, const uint8_t n) {
+    uint16_t s = 0;
+    for (uint16_t i = 0; i < OPS; ++i) s += c.find(static_cast<uint8_t>((i * 7) % n))->second;
+    sink = s;
+}
+
+template <class C>
+static inline void find_miss(C& c, const uint8_t n) {
+    uint16_t s = 0;
+    for (uint16_t i = 0; i < OPS; ++i) s += (c.find(static_cast<uint8_t>(n + i % n)) == c.end());
+    sink = s;
+}
+
+NOINLINE void map_find_hit_u8_8() { find_hit(map_u8_8, 8); }
+NOINLINE void map_find_hit_u8_32() { find_hit(map_u8_32, 32); }
+NOINLINE void map_find_miss_u8_32() { find_miss(map_u8_32, 32); }
+NOINLINE void flat_map_find_hit_u8_32() { find_hit(flat_map_u8_32, 32); }
+NOINLINE void flat_map_find_miss_u8_32() { find_miss(flat_map_u8_32, 32); }
+NOINLINE void unordered_map_find_hit_u8_32() { find_hit(unordered_map_u8_32, 32); }
+NOINLINE void unordered_map_find_miss_u8_32() { find_miss(unordered_map_u8_32, 32); }
+
+template <class C>
+static inline void insert_erase_key(C& c) {
+    uint16_t s = 0;
+    for (uint16_t i = 0; i < OPS; ++i) {
+        c[static_cast<uint8_t>(200 + (i & 1))] = static_cast<uint8_t>(i);
+        s += c.size();
+        c.erase(static_cast<uint8_t>(200 + (i & 1)));
+    }
+    sink = s;
+}
+
+NOINLINE void map_insert_erase_u8_32() { insert_erase_key(map_u8_32); }
+NOINLINE void flat_map_insert_erase_u8_32() { insert_erase_key(flat_map_u8_32); }
+NOINLINE void unordered_map_insert_erase_u8_32() { insert_erase_key(unordered_map_u8_32); }
+
+// ---------- main ----------
+
+template <class C>
+static void fill_map(C& c, const uint8_t n) {
+    // leave one slot free for insert_erase
+    for (uint8_t i = 0; i < n - 1; ++i) c[i] = i;
+}
+
+int main() {
+    // half full / full buffers, wrapped around
+    for (uint8_t i = 0; i < 8; ++i) rb_u8_16.push_back(i);
+    for (uint8_t i = 0; i < 8; ++i) rb_u8_15.push_back(i);
+    for (uint8_t i = 0; i < 16; ++i) rb_i16_32.push_back(i);
+    for (uint8_t i = 0; i < 4; ++i) dq_u8_8.push_back(i);
+    for (uint8_t i = 0; i < 15; ++i) vec_i16_16.push_back(i);
+    fill_map(map_u8_8, 8);
+    fill_map(map_u8_32, 32);
+    fill_map(flat_map_u8_32, 32);
+    fill_map(unordered_map_u8_32, 32);
+    // referenced, so that --gc-sections keeps the sizeof only globals
+    sink = dq_i16_16.size() + rb_u8_300.size();
+    dq_u8_8_it = dq_u8_8.begin();
+
+    RUN(kernel_empty);
+
+    RUN(ring_push_pop_u8_16);
+    RUN(ring_push_pop_u8_15);
+    RUN(ring_push_pop_i16_32);
+    RUN(ring_index_u8_16);
+    RUN(ring_index_u8_15);
+    RUN(deque_push_front_pop_back_u8_8);
+    RUN(ring_insert_erase_middle_u8_16);
+
+    RUN(vector_push_back_u8_16);
+    vec_u8_16.clear();
+    for (uint8_t i = 0; i < 15; ++i) vec_u8_16.push_back(i);
+    RUN(vector_insert_erase_front_u8_16);
+    RUN(vector_insert_erase_front_i16_16);
+
+    RUN(map_find_hit_u8_8);
+    RUN(map_find_hit_u8_32);
+    RUN(map_find_miss_u8_32);
+    RUN(flat_map_find_hit_u8_32);
+    RUN(flat_map_find_miss_u8_32);
+    RUN(unordered_map_find_hit_u8_32);
+    RUN(unordered_map_find_miss_u8_32);
+
+    RUN(map_insert_erase_u8_32);
+    RUN(flat_map_insert_erase_u8_32);
+    RUN(unordered_map_insert_erase_u8_32);
+
+    GPIOR0 = MARK_DONE;
+    // simavr stops when the cpu sleeps with interrupts disabled
+    cli();
+    sleep_enable();
+    sleep_cpu();
+    for (;;) {}
+}
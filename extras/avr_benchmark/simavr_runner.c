@@ -0,0 +1,122 @@
+// run the benchmark kernels (kernels.elf) under simavr and print the exact cycle count of each kernel as CSV:
+//   kernel,ops,cycles,cycles_per_op
+// cycles exclude the call/mark overhead measured by kernel_empty (its row shows the raw overhead).
+//
+// usage: simavr_runner <mcu> <elf>   (e.g. simavr_runner atmega328p kernels.elf)
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <sim_avr.h>
+#include <sim_elf.h>
+
+// data space addresses of GPIOR0..2 on ATmega328P (I/O address + 0x20)
+#define GPIOR0_ADDR 0x3E
+#define GPIOR1_ADDR 0x4A
+#define GPIOR2_ADDR 0x4B
+
+#define MARK_START 1
+#define MARK_STOP 2
+#define MARK_DONE 0xFF
+
+// give up if the firmware runs away
+#define MAX_CYCLES 2000000000ull
+
+struct bench_state {
+    char name[64];
+    size_t name_len;
+    unsigned ops;
+    int ops_bytes;
+    avr_cycle_count_t start;
+    long long overhead;
+    int done;
+};
+
+static void on_name(struct avr_t* avr, avr_io_addr_t addr, uint8_t v, void* param) {
+    (void)avr;
+    (void)addr;
+    struct bench_state* s = (struct bench_state*)param;
+    if (s->name_len < sizeof(s->name) - 1)
+        s->name[s->name_len++] = (char)v;
+    if (v == 0) {
+        s->name[s->name_len] = 0;
+        s->name_len = 0;
+        s->ops = 0;
+        s->ops_bytes = 0;
+    }
+}
+
+static void on_ops(struct avr_t* avr, avr_io_addr_t addr, uint8_t v, void* param) {
+    (void)avr;
+    (void)addr;
+    struct bench_state* s = (struct bench_state*)param;
+    s->ops |= (unsigned)v << (8 * s->ops_bytes++);
+}
+
+static void on_mark(struct avr_t* avr, avr_io_addr_t addr, uint8_t v, void* param) {
+    (void)addr;
+    struct bench_state* s = (struct bench_state*)param;
+    if (v == MARK_START) {
+        s->start = avr->cycle;
+    } else if (v == MARK_STOP) {
+        const long long raw = (long long)(avr->cycle - s->start);
+        if (s->overhead < 0) {
+            // the first kernel is kernel_empty
+            s->overhead = raw;
+            printf("%s,%u,%lld,%.2f\n", s->name, s->ops, raw, s->ops ? (double)raw / s->ops : 0.);
+        } else {
+            const long long cycles = raw - s->overhead;
+            printf("%s,%u,%lld,%.2f\n", s->name, s->ops, cycles, s->ops ? (double)cycles / s->ops : 0.);
+        }
+        fflush(stdout);
+    } else if (v == MARK_DONE) {
+        s->done = 1;
+    }
+}
+
+int main(int argc, char** argv) {
+    if (argc != 3) {
+        fprintf(stderr, "usage: %s <mcu> <elf>\n", argv[0]);
+        return 1;
+    }
+
+    elf_firmware_t firmware;
+    memset(&firmware, 0, sizeof(firmware));
+    if (elf_read_firmware(argv[2], &firmware) != 0) {
+        fprintf(stderr, "failed to read %s\n", argv[2]);
+        return 1;
+    }
+
+    avr_t* avr = avr_make_mcu_by_name(argv[1]);
+    if (!avr) {
+        fprintf(stderr, "unknown mcu %s\n", argv[1]);
+        return 1;
+    }
+    avr_init(avr);
+    avr->frequency = 16000000;
+    avr_load_firmware(avr, &firmware);
+
+    struct bench_state state;
+    memset(&state, 0, sizeof(state));
+    state.overhead = -1;
+    avr_register_io_write(avr, GPIOR2_ADDR, on_name, &state);
+    avr_register_io_write(avr, GPIOR1_ADDR, on_ops, &state);
+    avr_register_io_write(avr, GPIOR0_ADDR, on_mark, &state);
+
+    printf("kernel,ops,cycles,cycles_per_op\n");
+    for (;;) {
+        const int cpu = avr_run(avr);
+        if (cpu == cpu_Done || cpu == cpu_Crashed) break;
+        if (avr->cycle > MAX_CYCLES) {
+            fprintf(stderr, "timeout\n");
+            return 1;
+        }
+    }
+
+    if (!state.done) {
+        fprintf(stderr, "firmware stopped before all kernels finished\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,42 @@
+#!/bin/sh
+# flash and SRAM footprint of kernels.elf as CSV: symbol,section,bytes
+#   - each kernel function (.text, includes the inlined container code)
+#   - each container instance (.bss / .data)
+#   - total of each section
+# usage: size_report.sh <elf> [nm] [size]
+
+ELF=${1:?usage: size_report.sh <elf> [nm] [size]}
+NM=${2:-avr-nm}
+SIZE=${3:-avr-size}
+
+echo "symbol,section,bytes"
+
+# "address size type name" (sizes are hex)
+"$NM" -C -S --size-sort "$ELF" | awk '
+    function hex(s,    i, v) {
+        v = 0
+        for (i = 1; i <= length(s); ++i) v = v * 16 + index("0123456789abcdef", tolower(substr(s, i, 1))) - 1
+        return v
+    }
+    NF >= 4 {
+        type = $3
+        name = $4
+        for (i = 5; i <= NF; ++i) name = name " " $i
+        sub(/\(\)$/, "", name)
+        if (type == "T" || type == "t") {
+            if (name !~ /^(ring_|deque_|vector_|map_|flat_map_|unordered_map_|kernel_)/) next
+            section = ".text"
+        } else if (type == "B" || type == "b") {
+            section = ".bss"
+        } else if (type == "D" || type == "d") {
+            section = ".data"
+        } else {
+            next
+        }
+        # runtime and compiler-local symbols (__vector_*, completed.0, ...)
+        if (name ~ /^__/ || name ~ /\./) next
+        printf "%s,%s,%d\n", name, section, hex($2)
+    }'
+
+# section totals (SysV format: "section size address")
+"$SIZE" -A "$ELF" | awk '$1 == ".text" || $1 == ".data" || $1 == ".bss" { printf "total,%s,%d\n", $1, $2 }'
@@ -0,0 +1,145 @@
+#pragma once
+
+#ifndef ARX_CONTAINER_BENCH_H
+#define ARX_CONTAINER_BENCH_H
+
+// minimal host-side benchmark harness (Linux, g++/clang)
+// each benchmark is a function which runs `reps` operations and returns a checksum,
+// and is reported as one CSV row: suite,container,impl,op,type,N,ops,ns_per_op,instructions_per_op
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace arx_bench {
+
+// keep the compiler from optimizing the measured work away
+template <class T>
+inline void do_not_optimize(const T& v) {
+    __asm__ __volatile__("" : : "g"(&v) : "memory");
+}
+
+// user-space retired instructions (perf_event_open), if the kernel allows it
+class instruction_counter {
+    int fd {-1};
+
+public:
+    instruction_counter() {
+#if defined(__linux__)
+        perf_event_attr attr;
+        memset(&attr, 0, sizeof(attr));
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.size = sizeof(attr);
+        attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        fd = static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0));
+#endif
+    }
+    instruction_counter(const instruction_counter&) = delete;
+    instruction_counter& operator=(const instruction_counter&) = delete;
+    ~instruction_counter() {
+#if defined(__linux__)
+        if (fd >= 0) close(fd);
+#endif
+    }
+
+    bool available() const { return fd >= 0; }
+
+    void start() {
+#if defined(__linux__)
+        if (fd < 0) return;
+        ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+        ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+#endif
+    }
+
+    // NAN if not available
+    double stop() {
+#if defined(__linux__)
+        if (fd < 0) return NAN;
+        ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+        long long count = 0;
+        if (read(fd, &count, sizeof(count)) != static_cast<ssize_t>(sizeof(count))) return NAN;
+        return static_cast<double>(count);
+#else
+        return NAN;
+#endif
+    }
+};
+
+struct options {
+    double min_ms {20.};       // each measurement runs at least this long
+    const char* filter {""};  // run only rows whose name contains this
+};
+
+inline options& opts() {
+    static options o;
+    return o;
+}
+
+inline instruction_counter& counter() {
+    static instruction_counter c;
+    return c;
+}
+
+inline void print_header() {
+    printf("suite,container,impl,op,type,N,ops,ns_per_op,instructions_per_op\n");
+}
+
+// run fn(reps) with increasing reps until it takes min_ms, then report the last run per operation
+template <class Fn>
+inline void run(const char* suite, const char* container, const char* impl, const char* op,
+                const char* type, const size_t n, Fn fn) {
+    char name[256];
+    snprintf(name, sizeof(name), "%s,%s,%s,%s,%s,%zu", suite, container, impl, op, type, n);
+    if (!strstr(name, opts().filter)) return;
+
+    using clock = std::chrono::steady_clock;
+    do_not_optimize(fn(16));  // warm up
+    size_t reps = 64;
+    for (;;) {
+        counter().start();
+        const clock::time_point t0 = clock::now();
+        const size_t sum = fn(reps);
+        const clock::time_point t1 = clock::now();
+        const double insts = counter().stop();
+        do_not_optimize(sum);
+        const double ns = std::chrono::duration<double, std::nano>(t1 - t0).count();
+        if (ns >= opts().min_ms * 1e6 || reps >= (size_t(1) << 30)) {
+            printf("%s,%zu,%.3f,%.1f\n", name, reps, ns / reps, insts / reps);
+            fflush(stdout);
+            return;
+        }
+        reps *= 2;
+    }
+}
+
+inline void parse_args(int argc, char** argv) {
+    for (int i = 1; i < argc; ++i) {
+        if (!strcmp(argv[i], "--min-ms") && i + 1 < argc)
+            opts().min_ms = atof(argv[++i]);
+        else if (!strcmp(argv[i], "--filter") && i + 1 < argc)
+            opts().filter = argv[++i];
+        else {
+            fprintf(stderr, "usage: %s [--min-ms ms] [--filter substring]\n", argv[0]);
+            exit(1);
+        }
+    }
+    if (!counter().available())
+        fprintf(stderr, "note: hardware instruction counter is not available, instructions_per_op is nan\n");
+}
+
+}  // namespace arx_bench
+
+#endif  // ARX_CONTAINER_BENCH_H
@@ -0,0 +1,800 @@
+// host-side benchmark of arx containers against the standard library
+// build and run: make -C extras/benchmark run > bench.csv
+//
+// ArxContainer.h is compiled with ARX_HAVE_LIBSTDCPLUSPLUS=0 (see Makefile),
+// so the arx code paths are the same as on boards without libstdc++ (e.g. AVR).
+// the standard containers are included here directly as the baseline.
+
+#include <ArxContainer.h>
+
+#include <bitset>
+#include <deque>
+#include <iterator>
+#include <list>
+#include <map>
+#include <mutex>
+#include <set>
+#include <unordered_map>
+#include <utility>
+#include <thread>
+#include <vector>
+
+#include "bench.h"
+
+using arx_bench::run;
+
+// String-like type which always owns a heap buffer (as Arduino String does)
+class heap_string {
+    char* buf {nullptr};
+    size_t len {0};
+
+    void assign(const char* s, const size_t n) {
+        buf = static_cast<char*>(malloc(n + 1));
+        memcpy(buf, s, n + 1);
+        len = n;
+    }
+
+public:
+    heap_string() { assign("", 0); }
+    heap_string(const char* s) { assign(s, strlen(s)); }
+    heap_string(const heap_string& r) { assign(r.buf, r.len); }
+    heap_string(heap_string&& r) : buf(r.buf), len(r.len) {
+        r.buf = nullptr;
+        r.len = 0;
+    }
+    ~heap_string() { free(buf); }
+
+    heap_string& operator=(const heap_string& r) {
+        if (this != &r) {
+            free(buf);
+            assign(r.buf, r.len);
+        }
+        return *this;
+    }
+    heap_string& operator=(heap_string&& r) {
+        if (this != &r) {
+            free(buf);
+            buf = r.buf;
+            len = r.len;
+            r.buf = nullptr;
+            r.len = 0;
+        }
+        return *this;
+    }
+
+    const char* c_str() const { return buf ? buf : ""; }
+    size_t length() const { return len; }
+
+    bool operator==(const heap_string& r) const { return strcmp(c_str(), r.c_str()) == 0; }
+    bool operator!=(const heap_string& r) const { return !(*this == r); }
+    bool operator<(const heap_string& r) const { return strcmp(c_str(), r.c_str()) < 0; }
+};
+
+namespace arx {
+namespace container {
+    template <>
+    struct hash<heap_string> {
+        size_t operator()(const heap_string& s) const { return detail::string_hash(s.c_str(), s.length()); }
+    };
+}  // namespace container
+}  // namespace arx
+
+namespace std {
+template <>
+struct hash<heap_string> {
+    size_t operator()(const heap_string& s) const { return arx::container::detail::string_hash(s.c_str(), s.length()); }
+};
+}  // namespace std
+
+// ArxContainer.h is compiled without libstdc++, so std::hash<fixed_string> is not defined there
+using key_string = arx::stdx::fixed_string<15>;
+
+namespace std {
+template <>
+struct hash<key_string> {
+    size_t operator()(const key_string& s) const { return s.hash(); }
+};
+}  // namespace std
+
+// element types and their names in the output
+template <class T>
+struct value;
+
+template <>
+struct value<uint8_t> {
+    static const char* name() { return "uint8_t"; }
+    static uint8_t make(const size_t i) { return static_cast<uint8_t>(i); }
+    static size_t sum(const uint8_t v) { return v; }
+};
+
+template <>
+struct value<int32_t> {
+    static const char* name() { return "int32_t"; }
+    static int32_t make(const size_t i) { return static_cast<int32_t>(i * 2654435761u); }
+    static size_t sum(const int32_t v) { return static_cast<size_t>(v); }
+};
+
+template <>
+struct value<heap_string> {
+    static const char* name() { return "heap_string"; }
+    static heap_string make(const size_t i) {
+        char s[32];
+        snprintf(s, sizeof(s), "key_%zu", i);
+        return heap_string(s);
+    }
+    static size_t sum(const heap_string& v) { return v.length(); }
+};
+
+template <>
+struct value<key_string> {
+    static const char* name() { return "fixed_string<15>"; }
+    static key_string make(const size_t i) {
+        char s[32];
+        snprintf(s, sizeof(s), "key_%zu", i);
+        return key_string(s);
+    }
+    static size_t sum(const key_string& v) { return v.length(); }
+};
+
+// ---------- RingBuffer / deque ----------
+
+template <class C, class T>
+void fill(C& c, const size_t n) {
+    for (size_t i = 0; i < n; ++i) c.push_back(value<T>::make(i));
+}
+
+template <class T, size_t N>
+void bench_ring() {
+    const char* type = value<T>::name();
+    const std::vector<T> vals = [] {
+        std::vector<T> v;
+        for (size_t i = 0; i < 64; ++i) v.push_back(value<T>::make(i));
+        return v;
+    }();
+
+    // steady state FIFO: push one, pop one at half capacity
+    {
+        arx::RingBuffer<T, N> c;
+        fill<decltype(c), T>(c, N / 2);
+        run("ring", "RingBuffer", "arx", "push_back_pop_front", type, N, [&](size_t reps) {
+            size_t s = 0;
+            for (size_t i = 0; i < reps; ++i) {
+                c.push_back(vals[i & 63]);
+                s += value<T>::sum(c.front());
+                c.pop_front();
+            }
+            return s;
+        });
+    }
+    {
+        std::deque<T> c;
+        fill<decltype(c), T>(c, N / 2);
+        run("ring", "RingBuffer", "std::deque", "push_back_pop_front", type, N, [&](size_t reps) {
+            size_t s = 0;
+            for (size_t i = 0; i < reps; ++i) {
+                c.push_back(vals[i & 63]);
+                s += value<T>::sum(c.front());
+                c.pop_front();
+            }
+            return s;
+        });
+    }
+
+    // random access over a full buffer
+    {
+        arx::RingBuffer<T, N> c;
+        fill<decltype(c), T>(c, N + N / 2);  // wrapped around
+        run("ring", "RingBuffer", "arx", "operator[]", type, N, [&](size_t reps) {
+            size_t s = 0;
+            for (size_t i = 0; i < reps; ++i) s += value<T>::sum(c[i % N]);
+            return s;
+        });
+    }
+    {
+        std::deque<T> c;
+        fill<decltype(c), T>(c, N);
+        run("ring", "RingBuffer", "std::deque", "operator[]", type, N, [&](size_t reps) {
+            size_t s = 0;
+            for (size_t i = 0; i < reps; ++i) s += value<T>::sum(c[i % N]);
+            return s;
+        });
+    }
+
+    // push_front / pop_back
+    {
+        arx::stdx::deque<T, N> c;
+        fill<decltype(c), T>(c, N / 2);
+        run("ring", "deque", "arx", "push_front_pop_back", type, N, [&](size_t reps) {
+            size_t s = 0;
+            for (size_t i = 0; i < reps; ++i) {
+                c.push_front(vals[i & 63]);
+                s += value<T>::sum(c.back());
+                c.pop_back();
+            }
+            return s;
+        });
+    }
+    {
+        std::deque<T> c;
+        fill<decltype(c), T>(c, N / 2);
+        run("ring", "deque", "std::deque", "push_front_pop_back", type, N, [&](size_t reps) {
+            size_t s = 0;
+            for (size_t i = 0; i < reps; ++i) {
+                c.push_front(vals[i & 63]);
+                s += value<T>::sum(c.back());
+                c.pop_back();
+            }
+            return s;
+        });
+    }
+}
+
+// ---------- vector ----------
+
+template <class C, class T>
+void bench_vector_impl(const char* impl, C& c, const std::vector<T>& vals, const size_t n) {
+    const char* type = value<T>::name();
+
+    // fill up to the capacity and clear
+    run("vector", "vector", impl, "push_back", type, n, [&](size_t reps) {
+        size_t s = 0;
+        c.clear();
+        for (size_t i = 0; i < reps; ++i) {
+            if (c.size() == n) {
+                s += c.size();
+                c.clear();
+            }
+            c.push_back(vals[i & 63]);
+        }
+        return s;
+    });
+
+    // shift all elements (size n - 1)
+    c.clear();
+    fill<C, T>(c, n - 1);
+    run("vector", "vector", impl, "insert_erase_front", type, n, [&](size_t reps) {
+        size_t s = 0;
+        for (size_t i = 0; i < reps; ++i) {
+            c.insert(c.begin(), vals[i & 63]);
+            s += value<T>::sum(c[n / 2]);
+            c.erase(c.begin());
+        }
+        return s;
+    });
+
+    // shift half of the elements
+    run("vector", "vector", impl, "insert_erase_middle", type, n, [&](size_t reps) {
+        size_t s = 0;
+        for (size_t i = 0; i < reps; ++i) {
+            c.insert(c.begin() + n / 2, vals[i & 63]);
+            s += value<T>::sum(c[n / 2]);
+            c.erase(c.begin() + n / 2);
+        }
+        return s;
+    });
+}
+
+template <class T, size_t N>
+void bench_vector() {
+    std::vector<T> vals;
+    for (size_t i = 0; i < 64; ++i) vals.push_back(value<T>::make(i));
+    {
+        arx::stdx::vector<T, N> c;
+        bench_vector_impl("arx", c, vals, N);
+    }
+    {
+        std::vector<T> c;
+        c.reserve(N);
+        bench_vector_impl("std::vector", c, vals, N);
+    }
+}
+
+// ---------- map ----------
+
+template <class C, class K>
+void bench_map_impl(const char* container, const char* impl, C& c, const size_t n) {
+    const char* type = value<K>::name();
+    std::vector<K> keys;
+    for (size_t i = 0; i < 2 * n; ++i) keys.push_back(value<K>::make(i));
+    for (size_t i = 0; i < n; ++i) c[keys[i]] = static_cast<int32_t>(i);
+
+    run("map", container, impl, "find_hit", type, n, [&](size_t reps) {
+        size_t s = 0;
+        for (size_t i = 0; i < reps; ++i) s += static_cast<size_t>(c.find(keys[(i * 7) % n])->second);
+        return s;
+    });
+
+    run("map", container, impl, "find_miss", type, n, [&](size_t reps) {
+        size_t s = 0;
+        for (size_t i = 0; i < reps; ++i) s += (c.find(keys[n + (i * 7) % n]) == c.end());
+        return s;
+    });
+
+    run("map", container, impl, "operator[]", type, n, [&](size_t reps) {
+        size_t s = 0;
+        for (size_t i = 0; i < reps; ++i) s += static_cast<size_t>(c[keys[(i * 7) % n]]);
+        return s;
+    });
+
+    // one slot free: insert a new key and erase it
+    c.erase(keys[n - 1]);
+    run("map", container, impl, "insert_erase", type, n, [&](size_t reps) {
+        size_t s = 0;
+        for (size_t i = 0; i < reps; ++i) {
+            const K& k = keys[n - 1 + (i & 1) * n];
+            c.insert(typename C::value_type(k, static_cast<int32_t>(i)));
+            s += c.size();
+            c.erase(k);
+        }
+        return s;
+    });
+}
+
+// a table which has kept 3/4 of its capacity through many inserts and erases (e.g. a routing table)
+// (erased slots of open addressing tables may make the probes of missing keys longer)
+template <class C>
+void bench_map_churn(const char* impl, C& c, const size_t n) {
+    const size_t live = n * 3 / 4;
+    for (size_t i = 0; i < live; ++i) c[static_cast<int32_t>(i)] = static_cast<int32_t>(i);
+    for (size_t i = 0; i < 200000; ++i) {
+        c[static_cast<int32_t>(live + i)] = static_cast<int32_t>(i);
+        c.erase(static_cast<int32_t>(i));
+    }
+    run("map", "map", impl, "find_miss_churned", "int32_t", n, [&](size_t reps) {
+        size_t s = 0;
+        for (size_t i = 0; i < reps; ++i) s += (c.find(-1 - static_cast<int32_t>(i)) == c.end());
+        return s;
+    });
+}
+
+template <class K, size_t N>
+void bench_map() {
+    {
+        arx::stdx::map<K, int32_t, N> c;
+        bench_map_impl<decltype(c), K>("map", "arx", c, N);
+    }
+    {
+        arx::stdx::flat_map<K, int32_t, N> c;
+        bench_map_impl<decltype(c), K>("map", "arx::flat_map", c, N);
+    }
+    {
+        arx::stdx::unordered_map<K, int32_t, N> c;
+        bench_map_impl<decltype(c), K>("map", "arx::unordered_map", c, N);
+    }
+    {
+        std::map<K, int32_t> c;
+        bench_map_impl<decltype(c), K>("map", "std::map", c, N);
+    }
+    {
+        std::unordered_map<K, int32_t> c;
+        c.reserve(N);
+        bench_map_impl<decltype(c), K>("map", "std::unordered_map", c, N);
+    }
+}
+
+// ---------- range queries ----------
+
+// first element whose key is not less than t in an unsorted map (a scan of all elements)
+template <class C>
+typename C::const_iterator scan_lower_bound(const C& c, const uint32_t t) {
+    typename C::const_iterator r = c.end();
+    for (typename C::const_iterator it = c.begin(); it != c.end(); ++it)
+        if (!(it->first < t) && (r == c.end() || it->first < r->first)) r = it;
+    return r;
+}
+
+template <class C>
+size_t scan_count(const C& c, const uint32_t first, const uint32_t last) {
+    size_t n = 0;
+    for (typename C::const_iterator it = c.begin(); it != c.end(); ++it)
+        n += (!(it->first < first) && it->first < last);
+    return n;
+}
+
+// timestamps: two events per 10 ms
+template <class C>
+void fill_events(C& c, const size_t n) {
+    for (size_t i = 0; i < n; ++i) c.insert(typename C::value_type(static_cast<uint32_t>(i / 2 * 10), static_cast<int32_t>(i)));
+}
+
+template <class C>
+void bench_range_sorted(const char* impl, C& c, const size_t n) {
+    fill_events(c, n);
+    const uint32_t span = static_cast<uint32_t>(n * 5);
+
+    run("range", "multimap", impl, "lower_bound", "uint32_t", n, [&](size_t reps) {
+        size_t s = 0;
+        for (size_t i = 0; i < reps; ++i) {
+            auto it = c.lower_bound(static_cast<uint32_t>((i * 7) % span));
+            if (it != c.end()) s += static_cast<size_t>(it->second);
+        }
+        return s;
+    });
+
+    // events in a window of 100 ms
+    run("range", "multimap", impl, "count_range", "uint32_t", n, [&](size_t reps) {
+        size_t s = 0;
+        for (size_t i = 0; i < reps; ++i) {
+            const uint32_t t = static_cast<uint32_t>((i * 7) % span);
+            s += static_cast<size_t>(std::distance(c.lower_bound(t), c.lower_bound(t + 100)));
+        }
+        return s;
+    });
+
+    // one slot free: insert an event with an existing timestamp and erase it
+    c.erase(std::prev(c.end()));
+    run("range", "multimap", impl, "insert_erase", "uint32_t", n, [&](size_t reps) {
+        size_t s = 0;
+        for (size_t i = 0; i < reps; ++i) {
+            auto it = c.insert(typename C::value_type(static_cast<uint32_t>((i * 7) % span), static_cast<int32_t>(i)));
+            s += c.size();
+            c.erase(it);
+        }
+        return s;
+    });
+}
+
+template <size_t N>
+void bench_range() {
+    {
+        arx::stdx::multimap<uint32_t, int32_t, N> c;
+        bench_range_sorted("arx", c, N);
+    }
+    {
+        std::multimap<uint32_t, int32_t> c;
+        bench_range_sorted("std::multimap", c, N);
+    }
+    {
+        // what it took before multimap: arx::map with unique timestamps and a scan
+        arx::stdx::map<uint32_t, int32_t, N> c;
+        for (size_t i = 0; i < N; ++i) c.insert(static_cast<uint32_t>(i * 5), static_cast<int32_t>(i));
+        const uint32_t span = static_cast<uint32_t>(N * 5);
+        run("range", "multimap", "arx::map scan", "lower_bound", "uint32_t", N, [&](size_t reps) {
+            size_t s = 0;
+            for (size_t i = 0; i < reps; ++i) {
+                auto it = scan_lower_bound(c, static_cast<uint32_t>((i * 7) % span));
+                if (it != c.end()) s += static_cast<size_t>(it->second);
+            }
+            return s;
+        });
+        run("range", "multimap", "arx::map scan", "count_range", "uint32_t", N, [&](size_t reps) {
+            size_t s = 0;
+            for (size_t i = 0; i < reps; ++i) {
+                const uint32_t t = static_cast<uint32_t>((i * 7) % span);
+                s += scan_count(c, t, t + 100);
+            }
+            return s;
+        });
+    }
+}
+
+// ---------- copy / move ----------
+
+template <class C, class T>
+void bench_copy_impl(const char* container, const char* impl, const size_t n) {
+    const char* type = value<T>::name();
+    C src;
+    fill<C, T>(src, n);
+
+    run("copy", container, impl, "copy_construct", type, n, [&](size_t reps) {
+        size_t s = 0;
+        for (size_t i = 0; i < reps; ++i) {
+            C c(src);
+            s += c.size();
+        }
+        return s;
+    });
+
+    C a(src), b;
+    run("copy", container, impl, "move_assign", type, n, [&](size_t reps) {
+        size_t s = 0;
+        for (size_t i = 0; i < reps; ++i) {
+            if (i & 1)
+                a = std::move(b);
+            else
+                b = std::move(a);
+            s += a.size();
+        }
+        return s;
+    });
+}
+
+// double buffering: fill one buffer, swap it out and process it while the other one is filled
+template <class C, class T>
+void bench_swap_impl(const char* impl, const size_t n) {
+    const char* type = value<T>::name();
+    C filling, processing;
+    run("copy", "RingBuffer", impl, "swap_process", type, n, [&](size_t reps) {
+        size_t s = 0;
+        for (size_t i = 0; i < reps; ++i) {
+            for (size_t j = 0; j < n; ++j) filling.push_back(value<T>::make(i + j));
+            using std::swap;
+            swap(filling, processing);
+            for (size_t j = 0; j < processing.size(); ++j) s += value<T>::sum(processing[j]);
+            processing.clear();
+        }
+        return s;
+    });
+}
+
+template <class T, size_t N>
+void bench_copy() {
+    bench_copy_impl<arx::stdx::vector<T, N>, T>("vector", "arx", N);
+    bench_copy_impl<std::vector<T>, T>("vector", "std::vector", N);
+    bench_copy_impl<arx::RingBuffer<T, N>, T>("RingBuffer", "arx", N);
+    bench_copy_impl<std::deque<T>, T>("RingBuffer", "std::deque", N);
+    bench_swap_impl<arx::RingBuffer<T, N>, T>("arx", N);
+    bench_swap_impl<std::deque<T>, T>("std::deque", N);
+}
+
+// ---------- bit flags ----------
+
+// flags with about 1/16 set, so that find_next has to skip over runs of clear bits
+// (find_next benchmarks flip one bit and restore it, to keep the density)
+template <class C>
+void set_flags(C& c, const size_t n) {
+    for (size_t i = 0; i < n; ++i) c[i] = (value<int32_t>::make(i) & 15) == 0;
+}
+
+template <size_t N>
+void bench_bits() {
+    {
+        arx::stdx::bitset<N> c;
+        set_flags(c, N);
+        run("bits", "bitset", "arx", "count", "bool", N, [&](size_t reps) {
+            size_t s = 0;
+            for (size_t i = 0; i < reps; ++i) {
+                c.flip(i % N);
+                s += c.count();
+            }
+            return s;
+        });
+        set_flags(c, N);
+        run("bits", "bitset", "arx", "find_next", "bool", N, [&](size_t reps) {
+            size_t s = 0;
+            for (size_t i = 0; i < reps; ++i) {
+                c.flip(i % N);
+                for (size_t j = c.find_first(); j < N; j = c.find_next(j)) s += j;
+                c.flip(i % N);
+            }
+            return s;
+        });
+    }
+    {
+        std::bitset<N> c;
+        set_flags(c, N);
+        run("bits", "bitset", "std::bitset", "count", "bool", N, [&](size_t reps) {
+            size_t s = 0;
+            for (size_t i = 0; i < reps; ++i) {
+                c.flip(i % N);
+                s += c.count();
+            }
+            return s;
+        });
+        set_flags(c, N);
+        run("bits", "bitset", "std::bitset", "find_next", "bool", N, [&](size_t reps) {
+            size_t s = 0;
+            for (size_t i = 0; i < reps; ++i) {
+                c.flip(i % N);
+                for (size_t j = c._Find_first(); j < N; j = c._Find_next(j)) s += j;
+                c.flip(i % N);
+            }
+            return s;
+        });
+    }
+    {
+        // a byte per flag (as vector<bool> before it was packed)
+        arx::stdx::array<bool, N> c {};
+        set_flags(c, N);
+        run("bits", "bitset", "arx::array<bool>", "count", "bool", N, [&](size_t reps) {
+            size_t s = 0;
+            for (size_t i = 0; i < reps; ++i) {
+                c[i % N] = !c[i % N];
+                for (size_t j = 0; j < N; ++j) s += c[j];
+            }
+            return s;
+        });
+        set_flags(c, N);
+        run("bits", "bitset", "arx::array<bool>", "find_next", "bool", N, [&](size_t reps) {
+            size_t s = 0;
+            for (size_t i = 0; i < reps; ++i) {
+                c[i % N] = !c[i % N];
+                for (size_t j = 0; j < N; ++j)
+                    if (c[j]) s += j;
+                c[i % N] = !c[i % N];
+            }
+            return s;
+        });
+    }
+}
+
+// ---------- allocators of std containers ----------
+
+template <class C>
+void bench_alloc_list(const char* impl, C& c, const size_t n) {
+    fill<C, int32_t>(c, n);
+    // one node is freed and allocated per operation
+    run("alloc", "std::list", impl, "push_back_pop_front", "int32_t", n, [&](size_t reps) {
+        size_t s = 0;
+        for (size_t i = 0; i < reps; ++i) {
+            c.push_back(static_cast<int32_t>(i));
+            s += static_cast<size_t>(c.front());
+            c.pop_front();
+        }
+        return s;
+    });
+}
+
+template <class C>
+void bench_alloc_map(const char* impl, C& c, const size_t n) {
+    for (size_t i = 0; i < n; ++i) c[value<int32_t>::make(i)] = static_cast<int32_t>(i);
+    run("alloc", "std::map", impl, "insert_erase", "int32_t", n, [&](size_t reps) {
+        size_t s = 0;
+        for (size_t i = 0; i < reps; ++i) {
+            const int32_t k = value<int32_t>::make(n + (i & 7));
+            c.insert(typename C::value_type(k, static_cast<int32_t>(i)));
+            s += c.size();
+            c.erase(k);
+        }
+        return s;
+    });
+}
+
+// a vector built and dropped per operation
+template <class Make>
+void bench_alloc_vector(const char* impl, const size_t n, Make make) {
+    run("alloc", "std::vector", impl, "build_drop", "int32_t", n, [&](size_t reps) {
+        size_t s = 0;
+        for (size_t i = 0; i < reps; ++i) {
+            auto v = make();
+            v.reserve(n);
+            for (size_t j = 0; j < n; ++j) v.push_back(static_cast<int32_t>(j));
+            s += v.size();
+        }
+        return s;
+    });
+}
+
+template <size_t N>
+void bench_alloc() {
+    {
+        std::list<int32_t> c;
+        bench_alloc_list("std::allocator", c, N);
+    }
+    {
+        std::list<int32_t, arx::pool_allocator<int32_t, N + 1>> c;
+        bench_alloc_list("arx::pool_allocator", c, N);
+    }
+    {
+        std::map<int32_t, int32_t> c;
+        bench_alloc_map("std::allocator", c, N);
+    }
+    {
+        std::map<int32_t, int32_t, std::less<int32_t>, arx::pool_allocator<std::pair<const int32_t, int32_t>, N + 1>> c;
+        bench_alloc_map("arx::pool_allocator", c, N);
+    }
+    bench_alloc_vector("std::allocator", N, [] { return std::vector<int32_t>(); });
+    {
+        // the vector is the only (last) allocation, so it is released when dropped
+        static arx::static_arena<N * sizeof(int32_t) + 16> arena;
+        bench_alloc_vector("arx::monotonic_arena", N, [] {
+            return std::vector<int32_t, arx::arena_allocator<int32_t>>(arena);
+        });
+    }
+}
+
+// ---------- shared queue between threads ----------
+
+// what MpmcRingBuffer replaces: a RingBuffer behind a mutex
+template <class T, size_t N>
+class locked_ring {
+    std::mutex m;
+    arx::RingBuffer<T, N, arx::container::initialized_storage, arx::container::overflow::reject> q;
+
+public:
+    bool push(const T& v) {
+        std::lock_guard<std::mutex> lock(m);
+        return q.push(v) == arx::container::push_result::ok;
+    }
+    bool pop(T& v) {
+        std::lock_guard<std::mutex> lock(m);
+        if (q.empty()) return false;
+        v = q.front();
+        q.pop_front();
+        return true;
+    }
+};
+
+// `threads` producers and `threads` consumers transfer reps values in total
+// (an operation is a push and a pop; instructions_per_op counts only the main thread)
+template <class Q>
+size_t transfer(Q& q, const size_t threads, const size_t reps) {
+    const size_t per_thread = reps / threads + 1;
+    std::vector<size_t> sums(threads);
+    std::vector<std::thread> ts;
+    for (size_t t = 0; t < threads; ++t) {
+        ts.emplace_back([&q, per_thread] {
+            for (size_t i = 0; i < per_thread; ++i)
+                while (!q.push(static_cast<int32_t>(i))) std::this_thread::yield();
+        });
+        ts.emplace_back([&q, &sums, t, per_thread] {
+            size_t s = 0;
+            int32_t v;
+            for (size_t i = 0; i < per_thread;) {
+                if (q.pop(v)) {
+                    s += static_cast<size_t>(v);
+                    ++i;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+            sums[t] = s;
+        });
+    }
+    for (auto& t : ts) t.join();
+    size_t s = 0;
+    for (size_t v : sums) s += v;
+    return s;
+}
+
+template <size_t N>
+void bench_mpmc() {
+    static const size_t threads[] = {1, 2, 4, 8};
+    for (size_t t : threads) {
+        char op[16];
+        snprintf(op, sizeof(op), "%zup%zuc", t, t);
+        {
+            static arx::MpmcRingBuffer<int32_t, N> q;
+            run("mpmc", "MpmcRingBuffer", "arx", op, "int32_t", N, [&](size_t reps) { return transfer(q, t, reps); });
+        }
+        {
+            static locked_ring<int32_t, N> q;
+            run("mpmc", "MpmcRingBuffer", "RingBuffer+mutex", op, "int32_t", N, [&](size_t reps) { return transfer(q, t, reps); });
+        }
+    }
+}
+
+// ---------- all ----------
+
+template <class T, size_t N>
+void bench_containers() {
+    bench_ring<T, N>();
+    bench_vector<T, N>();
+    bench_copy<T, N>();
+}
+
+template <size_t N>
+void bench_size() {
+    bench_containers<uint8_t, N>();
+    bench_containers<int32_t, N>();
+    bench_containers<heap_string, N>();
+    // uint8_t keys can't make 2N distinct keys (hits and misses) if N > 128
+    if (N <= 128) bench_map<uint8_t, (N <= 128 ? N : 128)>();
+    bench_map<int32_t, N>();
+    {
+        arx::stdx::unordered_map<int32_t, int32_t, N> c;
+        bench_map_churn("arx::unordered_map", c, N);
+    }
+    {
+        std::unordered_map<int32_t, int32_t> c;
+        c.reserve(N);
+        bench_map_churn("std::unordered_map", c, N);
+    }
+    bench_map<heap_string, N>();
+    bench_map<key_string, N>();
+    bench_range<N>();
+    bench_alloc<N>();
+    bench_bits<N>();
+    // thread scaling (N must be a power of two)
+    if (N >= 64) bench_mpmc<N>();
+}
+
+int main(int argc, char** argv) {
+    arx_bench::parse_args(argc, argv);
+    arx_bench::print_header();
+    bench_size<8>();
+    bench_size<16>();
+    bench_size<64>();
+    bench_size<256>();
+    return 0;
+}
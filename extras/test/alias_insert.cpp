@@ -0,0 +1,183 @@
+// inserting (or removing) a value which refers to an element of the same container
+// build and run: make -C extras/test run
+// (make -C extras/test run SANITIZE=address also catches reads of destroyed elements)
+//
+// insert() must read the value before any element is moved to make room for the new one
+// (shifted, swapped by a rehash, ...), like the std containers.
+// each case runs random inserts and erases, and inserts copies of existing elements,
+// against the std container as reference.
+
+#include <ArxContainer.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <list>
+#include <map>
+#include <string>
+
+namespace {
+
+// xorshift
+struct rng {
+    uint32_t s;
+    uint32_t next() {
+        s ^= s << 13;
+        s ^= s >> 17;
+        s ^= s << 5;
+        return s;
+    }
+};
+
+bool report(const char* name, const uint32_t count, const bool ok) {
+    printf("alias_insert %s count=%u : %s\n", name, count, ok ? "ok" : "FAILED");
+    return ok;
+}
+
+template <class V>
+V make_value(const uint32_t n);
+
+template <>
+int make_value<int>(const uint32_t n) {
+    return static_cast<int>(n);
+}
+
+// long enough not to fit in the small string buffer, so a moved-from one is empty
+template <>
+std::string make_value<std::string>(const uint32_t n) {
+    return std::string("value which is not a short string ") + std::to_string(n);
+}
+
+// random insert/erase on 16 keys, and insert(k, m.at(j)) from an existing key j
+template <class Map, class V>
+bool map_insert(const char* name, const uint32_t count) {
+    Map m;
+    std::map<int, V> ref;
+    rng r {12345};
+    bool ok = true;
+    for (uint32_t n = 0; n < count && ok; ++n) {
+        const int k = static_cast<int>(r.next() % 16);
+        const uint32_t op = r.next() % 3;
+        if (op == 0) {
+            const V v = make_value<V>(r.next());
+            if (m.insert(k, v).second) ref.insert(std::make_pair(k, v));
+        } else if (op == 1) {
+            m.erase(k);
+            ref.erase(k);
+        } else if (!ref.empty()) {
+            typename std::map<int, V>::iterator src = ref.begin();
+            for (uint32_t i = r.next() % ref.size(); i; --i) ++src;
+            if (m.insert(k, m.at(src->first)).second) ref.insert(std::make_pair(k, src->second));
+        }
+        ok = m.size() == ref.size();
+        for (typename std::map<int, V>::iterator it = ref.begin(); ok && it != ref.end(); ++it) {
+            ok = m.find(it->first) != m.end() && m.at(it->first) == it->second;
+        }
+    }
+    return report(name, count, ok);
+}
+
+// random push/pop at both ends (below the capacity), and insert(begin() + p, d[q])
+// d refers to an empty deque with capacity 8
+template <class V, class Deque>
+bool deque_insert(const char* name, const uint32_t count, Deque d) {
+    std::deque<V> ref;
+    rng r {12345};
+    bool ok = true;
+    for (uint32_t n = 0; n < count && ok; ++n) {
+        const uint32_t op = r.next() % 4;
+        if (op == 0 && ref.size() < 7) {
+            const V v = make_value<V>(r.next());
+            if (r.next() % 2) {
+                d.push_back(v);
+                ref.push_back(v);
+            } else {
+                d.push_front(v);
+                ref.push_front(v);
+            }
+        } else if (op == 1 && !ref.empty()) {
+            if (r.next() % 2) {
+                d.pop_back();
+                ref.pop_back();
+            } else {
+                d.pop_front();
+                ref.pop_front();
+            }
+        } else if (!ref.empty() && ref.size() < 7) {
+            const size_t p = r.next() % (ref.size() + 1);
+            const size_t q = r.next() % ref.size();
+            d.insert(d.begin() + p, d[q]);
+            ref.insert(ref.begin() + p, ref[q]);
+        }
+        ok = d.size() == ref.size();
+        for (size_t i = 0; ok && i < ref.size(); ++i) ok = d[i] == ref[i];
+    }
+    return report(name, count, ok);
+}
+
+// random push/pop at both ends (below the capacity), and remove(an element) which erases that element too
+template <class V>
+bool list_remove(const char* name, const uint32_t count) {
+    // elements are destroyed on erase
+    using list = arx::stdx::list<V, 8, arx::container::uninitialized_storage>;
+    list l;
+    std::list<V> ref;
+    rng r {12345};
+    bool ok = true;
+    for (uint32_t n = 0; n < count && ok; ++n) {
+        const uint32_t op = r.next() % 3;
+        if (op == 0 && ref.size() < 8) {
+            // few distinct values, so remove() erases several elements
+            const V v = make_value<V>(r.next() % 4);
+            if (r.next() % 2) {
+                l.push_back(v);
+                ref.push_back(v);
+            } else {
+                l.push_front(v);
+                ref.push_front(v);
+            }
+        } else if (op == 1 && !ref.empty()) {
+            l.pop_front();
+            ref.pop_front();
+        } else if (!ref.empty()) {
+            const uint32_t k = r.next() % static_cast<uint32_t>(ref.size());
+            typename list::iterator it = l.begin();
+            typename std::list<V>::iterator rit = ref.begin();
+            for (uint32_t i = 0; i < k; ++i) ++it, ++rit;
+            l.remove(*it);
+            ref.remove(*rit);
+        }
+        ok = l.size() == ref.size();
+        typename std::list<V>::iterator rit = ref.begin();
+        for (typename list::iterator it = l.begin(); ok && it != l.end(); ++it, ++rit) {
+            ok = *it == *rit;
+        }
+    }
+    return report(name, count, ok);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const uint32_t count = (argc > 1) ? static_cast<uint32_t>(strtoul(argv[1], nullptr, 10)) : 100000;
+    bool ok = true;
+    // a tombstone-heavy table rehashes on insert, which swaps the elements the value may refer to
+    ok = map_insert<arx::stdx::unordered_map<int, int, 8>, int>("unordered_map", count) && ok;
+    // the elements after the new key are shifted
+    ok = map_insert<arx::stdx::flat_map<int, int, 8>, int>("flat_map<int>", count) && ok;
+    ok = map_insert<arx::stdx::flat_map<int, std::string, 8>, std::string>("flat_map<string>", count) && ok;
+    // the shorter side of the ring is shifted towards the new slot
+    arx::stdx::deque<int, 8> di;
+    arx::stdx::deque<std::string, 8> ds;
+    ok = deque_insert<int, arx::stdx::deque<int, 8>&>("deque<int>", count, di) && ok;
+    ok = deque_insert<std::string, arx::stdx::deque<std::string, 8>&>("deque<string>", count, ds) && ok;
+    // deque_ref shifts the elements by itself
+    di.clear();
+    ds.clear();
+    ok = deque_insert<int, arx::stdx::deque_ref<int>>("deque_ref<int>", count, di) && ok;
+    ok = deque_insert<std::string, arx::stdx::deque_ref<std::string>>("deque_ref<string>", count, ds) && ok;
+    // remove() erases the element its argument refers to
+    ok = list_remove<int>("list<int>", count) && ok;
+    ok = list_remove<std::string>("list<string>", count) && ok;
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,134 @@
+// stress test of SpscRingBuffer with a producer thread and a consumer thread
+// build and run: make -C extras/test run
+//
+// the producer pushes a sequence of numbered elements with single and bulk push(),
+// and the consumer checks with single and bulk pop() / peek() that every element
+// arrives exactly once, in order and not torn.
+// both sides yield when the queue is full or empty, so it also finishes on a single core.
+
+#include <ArxContainer.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+
+namespace {
+
+// two words which must always match (a torn copy breaks check)
+struct item {
+    uint32_t seq;
+    uint32_t check;
+};
+
+item make_item(const uint32_t seq) {
+    return item {seq, ~seq * 2654435761u};
+}
+
+bool is_item(const item& v, const uint32_t seq) {
+    return v.seq == seq && v.check == ~seq * 2654435761u;
+}
+
+// xorshift: each thread has its own
+struct rng {
+    uint32_t s;
+    uint32_t next() {
+        s ^= s << 13;
+        s ^= s >> 17;
+        s ^= s << 5;
+        return s;
+    }
+};
+
+template <size_t N>
+bool stress(const uint32_t count) {
+    static arx::SpscRingBuffer<item, N> q;
+    // bulk operations span more than the capacity to hit partial and wrapped copies
+    const uint32_t max_bulk = 2 * N + 3;
+
+    std::thread producer([count, max_bulk] {
+        rng r {12345};
+        item buf[2 * N + 3];
+        uint32_t seq = 0;
+        while (seq < count) {
+            size_t pushed;
+            if (r.next() % 2) {
+                pushed = q.push(make_item(seq)) ? 1 : 0;
+            } else {
+                uint32_t n = 1 + r.next() % max_bulk;
+                if (n > count - seq) n = count - seq;
+                for (uint32_t i = 0; i < n; ++i) buf[i] = make_item(seq + i);
+                pushed = q.push(buf, n);
+            }
+            seq += static_cast<uint32_t>(pushed);
+            if (!pushed) std::this_thread::yield();
+        }
+    });
+
+    bool ok = true;
+    rng r {67890};
+    item buf[2 * N + 3];
+    uint32_t seq = 0;
+    while (seq < count && ok) {
+        size_t popped = 0;
+        switch (r.next() % 4) {
+            case 0: {
+                item v;
+                if (q.pop(v)) {
+                    ok = is_item(v, seq);
+                    popped = 1;
+                }
+                break;
+            }
+            case 1: {
+                const size_t n = 1 + r.next() % max_bulk;
+                popped = q.pop(buf, n);
+                ok = popped <= n;
+                for (size_t i = 0; ok && i < popped; ++i) ok = is_item(buf[i], seq + static_cast<uint32_t>(i));
+                break;
+            }
+            case 2: {
+                item v;
+                if (q.peek(v)) ok = is_item(v, seq);
+                item w;
+                if (q.pop(w)) {
+                    ok = ok && is_item(w, seq);
+                    popped = 1;
+                }
+                break;
+            }
+            default: {
+                // elements peeked in bulk must stay in the queue
+                const size_t n = 1 + r.next() % max_bulk;
+                const size_t len = q.peek(buf, n);
+                ok = len <= n;
+                for (size_t i = 0; ok && i < len; ++i) ok = is_item(buf[i], seq + static_cast<uint32_t>(i));
+                break;
+            }
+        }
+        if (ok && q.size() > N) ok = false;
+        seq += static_cast<uint32_t>(popped);
+        if (!popped) std::this_thread::yield();
+    }
+    if (!ok) {
+        // let the producer finish
+        item v;
+        while (seq < count) seq += q.pop(v) ? 1 : 0;
+    }
+    producer.join();
+    ok = ok && q.empty();
+
+    printf("spsc_stress N=%zu count=%u : %s\n", N, count, ok ? "ok" : "FAILED");
+    return ok;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const uint32_t count = (argc > 1) ? static_cast<uint32_t>(strtoul(argv[1], nullptr, 10)) : 1000000;
+    bool ok = true;
+    ok = stress<1>(count / 10) && ok;
+    ok = stress<7>(count) && ok;
+    ok = stress<64>(count) && ok;
+    ok = stress<300>(count) && ok;
+    return ok ? 0 : 1;
+}